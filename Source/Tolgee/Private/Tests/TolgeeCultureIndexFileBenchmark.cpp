@@ -0,0 +1,105 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/FileManager.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/Paths.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeCultureIndexFile.h"
+#include "TolgeePoParser.h"
+#include "TolgeeTestCorpus.h"
+
+namespace
+{
+	constexpr int32 NumBenchmarkEntries = 100000;
+	constexpr int32 NumBenchmarkRuns = 5;
+	/**
+	 * Time allowed to make the cached translations available at boot.
+	 */
+	constexpr double LoadBudget = 0.005;
+	const TCHAR* BenchmarkContentHash = TEXT("0123456789ABCDEF0123456789ABCDEF01234567");
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeCultureIndexFileBenchmarkTest, "Tolgee.Runtime.CultureIndexFile.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FTolgeeCultureIndexFileBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FTolgeeCultureIndexBuilder Builder;
+	TolgeePoParser::ParseIntoIndex(TolgeeTestCorpus::MakePoContent(ETolgeeTestScript::Latin, NumBenchmarkEntries), Builder);
+	const FTolgeeCultureIndexRef Expected = Builder.Build();
+
+	const FString Path = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("TolgeeCultureIndexFile.bin"));
+	if (!TestTrue(TEXT("Index saved"), TolgeeCultureIndexFile::Save(Path, *Expected, BenchmarkContentHash)))
+	{
+		return false;
+	}
+
+	double BestLoadTime = TNumericLimits<double>::Max();
+	TOptional<FTolgeeCultureIndexRef> Loaded;
+	for (int32 Run = 0; Run < NumBenchmarkRuns; ++Run)
+	{
+		Loaded.Reset();
+
+		const double LoadStartTime = FPlatformTime::Seconds();
+		Loaded = TolgeeCultureIndexFile::Load(Path, BenchmarkContentHash);
+		BestLoadTime = FMath::Min(BestLoadTime, FPlatformTime::Seconds() - LoadStartTime);
+	}
+
+	if (!TestTrue(TEXT("Index loaded"), Loaded.IsSet()))
+	{
+		IFileManager::Get().Delete(*Path);
+		return false;
+	}
+
+	// NOTE: The loaded indices read from the file, they are released before it is deleted.
+	{
+		const FTolgeeCultureIndexRef Index = Loaded.GetValue();
+		TestEqual(TEXT("Loaded entries"), Index->Num(), Expected->Num());
+		TestTrue(FString::Printf(TEXT("%d entries loaded in under %.0f ms"), NumBenchmarkEntries, LoadBudget * 1000.0), BestLoadTime < LoadBudget);
+
+		// The loaded index has to answer like the one it was saved from, checked on a sample of the entries.
+		for (int32 EntryIndex = 0; EntryIndex < Expected->Num(); EntryIndex += 997)
+		{
+			const int32 Position = Index->Find(Expected->GetId(EntryIndex));
+			if (!TestTrue(TEXT("Entry found in the loaded index"), Position != INDEX_NONE))
+			{
+				break;
+			}
+			TestTrue(TEXT("Loaded translation"), Index->GetTranslation(Position).Equals(Expected->GetTranslation(EntryIndex), ESearchCase::CaseSensitive));
+			TestEqual(TEXT("Loaded source string hash"), Index->GetSourceStringHash(Position), Expected->GetSourceStringHash(EntryIndex));
+		}
+
+		// Patching the loaded index copies the touched chunks and lookup buckets and leaves the file untouched.
+		FTolgeeCultureIndexBuilder PatchBuilder(Index);
+		PatchBuilder.Add(Expected->GetId(10), 10, TEXT("Patched"));
+		PatchBuilder.Remove(Expected->GetId(20));
+		PatchBuilder.Add(FTextId(FTextKey(TEXT("Patch")), FTextKey(TEXT("Added"))), 0, TEXT("Added"));
+		const FTolgeeCultureIndexRef Patched = PatchBuilder.Build();
+
+		TestEqual(TEXT("Patched entries"), Patched->Num(), Expected->Num());
+		TestTrue(TEXT("Patched translation"), Patched->GetTranslation(Patched->Find(Expected->GetId(10))).Equals(TEXT("Patched"), ESearchCase::CaseSensitive));
+		TestEqual(TEXT("Removed entry"), Patched->Find(Expected->GetId(20)), INDEX_NONE);
+		TestTrue(TEXT("Loaded index keeps the removed entry"), Index->Find(Expected->GetId(20)) != INDEX_NONE);
+
+		for (int32 Position = 0; Position < Patched->Num(); ++Position)
+		{
+			if (Patched->Find(Patched->GetId(Position)) != Position)
+			{
+				AddError(FString::Printf(TEXT("Lookup of the patched entry at %d points elsewhere."), Position));
+				break;
+			}
+		}
+	}
+	Loaded.Reset();
+
+	AddInfo(FString::Printf(TEXT("Loaded %d cached entries in %.2f ms."), NumBenchmarkEntries, BestLoadTime * 1000.0));
+
+	IFileManager::Get().Delete(*Path);
+	return true;
+}
+
+#endif
@@ -0,0 +1,132 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/PlatformTime.h>
+#include <Internationalization/TextLocalizationResource.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeLocalizationInjectorSubsystem.h"
+#include "TolgeePoParser.h"
+#include "TolgeeTestCorpus.h"
+
+namespace
+{
+	constexpr int32 NumBenchmarkEntries = 100000;
+	constexpr int32 NumBenchmarkRuns = 5;
+
+	/**
+	 * Per-entry data the injection used before the pre-keyed index: plain strings turned into text keys on every refresh.
+	 */
+	struct FLegacyTranslationData
+	{
+		FString ParsedNamespace;
+		FString ParsedKey;
+		FString Translation;
+	};
+
+	/**
+	 * Injection loop as it was before the pre-keyed index, kept as the baseline of the benchmark.
+	 */
+	int32 InjectLegacy(const TMap<FString, TArray<FLegacyTranslationData>>& CachedTranslations, TArrayView<const FString> PrioritizedCultures, FTextLocalizationResource& InOutLocalizedResource)
+	{
+		int32 NumInjected = 0;
+
+		// NOTE: The cache used to be copied on every refresh.
+		const TMap<FString, TArray<FLegacyTranslationData>> DataToInject = CachedTranslations;
+		for (const TPair<FString, TArray<FLegacyTranslationData>>& CachedTranslation : DataToInject)
+		{
+			if (!PrioritizedCultures.Contains(CachedTranslation.Key))
+			{
+				continue;
+			}
+
+			for (const FLegacyTranslationData& TranslationData : CachedTranslation.Value)
+			{
+				const FTextKey InNamespace = TranslationData.ParsedNamespace;
+				const FTextKey InKey = TranslationData.ParsedKey;
+
+				if (FTextLocalizationResource::FEntry* ExistingEntry = InOutLocalizedResource.Entries.Find(FTextId(InNamespace, InKey)))
+				{
+					InOutLocalizedResource.AddEntry(InNamespace, InKey, ExistingEntry->SourceStringHash, TranslationData.Translation, -1);
+					NumInjected++;
+				}
+			}
+		}
+
+		return NumInjected;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeInjectionBenchmarkTest, "Tolgee.Runtime.Injection.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FTolgeeInjectionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const TArray<uint8> PoContent = TolgeeTestCorpus::MakePoContent(ETolgeeTestScript::Latin, NumBenchmarkEntries);
+
+	const double ParseStartTime = FPlatformTime::Seconds();
+	FTolgeeCultureIndexBuilder Builder;
+	const bool bParsed = TolgeePoParser::ParseIntoIndex(PoContent, Builder);
+	const FTolgeeCultureIndexRef CultureIndex = Builder.Build();
+	const double ParseTime = FPlatformTime::Seconds() - ParseStartTime;
+
+	TestTrue(TEXT("Benchmark corpus parsed"), bParsed);
+	TestEqual(TEXT("Parsed entries"), CultureIndex->Num(), NumBenchmarkEntries);
+
+	// The native resource contains every entry, as the game's LocRes would.
+	FTextLocalizationResource NativeResource;
+	TMap<FString, TArray<FLegacyTranslationData>> LegacyTranslations;
+	TArray<FLegacyTranslationData>& LegacyCulture = LegacyTranslations.Add(TEXT("de"));
+	LegacyCulture.Reserve(NumBenchmarkEntries);
+	for (int32 EntryIndex = 0; EntryIndex < CultureIndex->Num(); ++EntryIndex)
+	{
+		const FString Namespace = TolgeeTestCorpus::GetNamespace(EntryIndex);
+		const FString Key = TolgeeTestCorpus::GetKey(EntryIndex);
+		NativeResource.AddEntry(FTextKey(Namespace), FTextKey(Key), CultureIndex->GetSourceStringHash(EntryIndex), TEXT("Native"), 0);
+		LegacyCulture.Add({Namespace, Key, FString(CultureIndex->GetTranslation(EntryIndex))});
+	}
+
+	const TArray<FString> PrioritizedCultures = {TEXT("de-AT"), TEXT("de"), TEXT("en")};
+
+	double BestLegacyTime = TNumericLimits<double>::Max();
+	double BestIndexTime = TNumericLimits<double>::Max();
+	for (int32 Run = 0; Run < NumBenchmarkRuns; ++Run)
+	{
+		FTextLocalizationResource LegacyResource = NativeResource;
+		const double LegacyStartTime = FPlatformTime::Seconds();
+		const int32 NumLegacyInjected = InjectLegacy(LegacyTranslations, PrioritizedCultures, LegacyResource);
+		BestLegacyTime = FMath::Min(BestLegacyTime, FPlatformTime::Seconds() - LegacyStartTime);
+
+		FTextLocalizationResource IndexResource = NativeResource;
+		TMap<FTextId, uint32> LiveSourceStringHashes;
+		const double IndexStartTime = FPlatformTime::Seconds();
+		const int32 NumIndexInjected = UTolgeeLocalizationInjectorSubsystem::InjectCulture(*CultureIndex, IndexResource, LiveSourceStringHashes);
+		BestIndexTime = FMath::Min(BestIndexTime, FPlatformTime::Seconds() - IndexStartTime);
+
+		TestEqual(TEXT("Entries injected by the legacy loop"), NumLegacyInjected, NumBenchmarkEntries);
+		TestEqual(TEXT("Entries injected from the index"), NumIndexInjected, NumBenchmarkEntries);
+
+		// Both paths have to produce the same resource, checked on a sample of the entries.
+		for (int32 EntryIndex = 0; EntryIndex < NumBenchmarkEntries; EntryIndex += 997)
+		{
+			const FTextId TextId = CultureIndex->GetId(EntryIndex);
+			const FTextLocalizationResource::FEntry* LegacyEntry = LegacyResource.Entries.Find(TextId);
+			const FTextLocalizationResource::FEntry* IndexEntry = IndexResource.Entries.Find(TextId);
+			if (!TestTrue(TEXT("Entry injected by both paths"), LegacyEntry && IndexEntry))
+			{
+				return false;
+			}
+			TestEqual(TEXT("Injected translation"), IndexEntry->LocalizedString, LegacyEntry->LocalizedString);
+			TestEqual(TEXT("Injected source string hash"), IndexEntry->SourceStringHash, LegacyEntry->SourceStringHash);
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Parsed %d entries (%.1f MB) in %.2f ms."), NumBenchmarkEntries, PoContent.Num() / (1024.0 * 1024.0), ParseTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Injection of %d entries: legacy %.2f ms, pre-keyed index %.2f ms (%.1fx)."), NumBenchmarkEntries, BestLegacyTime * 1000.0, BestIndexTime * 1000.0, BestLegacyTime / FMath::Max(BestIndexTime, UE_SMALL_NUMBER)));
+
+	return true;
+}
+
+#endif
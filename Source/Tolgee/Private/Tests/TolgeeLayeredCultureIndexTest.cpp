@@ -0,0 +1,104 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/PlatformTime.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeLayeredCultureIndex.h"
+#include "TolgeeTestCorpus.h"
+
+namespace
+{
+	constexpr int32 NumBaseEntries = 50000;
+	constexpr int32 NumOverriddenEntries = 100;
+
+	FTextId MakeTestId(int32 EntryIndex)
+	{
+		return FTextId(FTextKey(TolgeeTestCorpus::GetNamespace(EntryIndex)), FTextKey(TolgeeTestCorpus::GetKey(EntryIndex)));
+	}
+
+	/**
+	 * Builds a layer translating the given range of entries with the given prefix.
+	 */
+	FTolgeeCultureIndexRef MakeLayer(int32 FirstEntry, int32 NumEntries, const FString& Prefix)
+	{
+		FTolgeeCultureIndexBuilder Builder;
+		Builder.Reserve(NumEntries);
+		for (int32 EntryIndex = FirstEntry; EntryIndex < FirstEntry + NumEntries; ++EntryIndex)
+		{
+			Builder.Add(MakeTestId(EntryIndex), EntryIndex, FString::Printf(TEXT("%s %d"), *Prefix, EntryIndex));
+		}
+		return Builder.Build();
+	}
+
+	/**
+	 * Returns the translation of the entry or an empty string if the index doesn't translate it.
+	 */
+	FString FindTranslation(const FTolgeeCultureIndex& Index, int32 EntryIndex)
+	{
+		const int32 Position = Index.Find(MakeTestId(EntryIndex));
+		return Position != INDEX_NONE ? FString(Index.GetTranslation(Position)) : FString();
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeLayeredCultureIndexTest, "Tolgee.Runtime.LayeredCultureIndex.Patch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeLayeredCultureIndexTest::RunTest(const FString& Parameters)
+{
+	FTolgeeLayeredCultureIndex LayeredIndex;
+
+	LayeredIndex.SetLayer(0, MakeLayer(0, NumBaseEntries, TEXT("Base")));
+	LayeredIndex.SetLayer(1, MakeLayer(0, NumOverriddenEntries, TEXT("Dlc")));
+
+	const FTolgeeCultureIndexRef FirstMerged = LayeredIndex.GetMerged();
+	TestEqual(TEXT("Merged entries"), FirstMerged->Num(), NumBaseEntries);
+	TestEqual(TEXT("Overridden entry"), FindTranslation(*FirstMerged, 7), FString(TEXT("Dlc 7")));
+	TestEqual(TEXT("Base entry"), FindTranslation(*FirstMerged, NumBaseEntries - 1), FString::Printf(TEXT("Base %d"), NumBaseEntries - 1));
+
+	// The base layer changes a single entry, drops another one and still translates an overridden one differently.
+	FTolgeeCultureIndexBuilder BaseBuilder(MakeLayer(0, NumBaseEntries, TEXT("Base")));
+	BaseBuilder.Add(MakeTestId(1000), 1000, TEXT("Changed"));
+	BaseBuilder.Add(MakeTestId(7), 7, TEXT("Hidden"));
+	BaseBuilder.Remove(MakeTestId(2000));
+
+	const double PatchStartTime = FPlatformTime::Seconds();
+	LayeredIndex.SetLayer(0, BaseBuilder.Build());
+	const double PatchTime = FPlatformTime::Seconds() - PatchStartTime;
+
+	const FTolgeeCultureIndexRef SecondMerged = LayeredIndex.GetMerged();
+	TestEqual(TEXT("Entries after the base update"), SecondMerged->Num(), NumBaseEntries - 1);
+	TestEqual(TEXT("Changed entry"), FindTranslation(*SecondMerged, 1000), FString(TEXT("Changed")));
+	TestEqual(TEXT("Removed entry"), SecondMerged->Find(MakeTestId(2000)), INDEX_NONE);
+	TestEqual(TEXT("Entry still overridden"), FindTranslation(*SecondMerged, 7), FString(TEXT("Dlc 7")));
+
+	// Every position has to be consistent with the lookup after the removal moved an entry.
+	for (int32 Position = 0; Position < SecondMerged->Num(); ++Position)
+	{
+		if (SecondMerged->Find(SecondMerged->GetId(Position)) != Position)
+		{
+			AddError(FString::Printf(TEXT("Lookup of the entry at %d points elsewhere."), Position));
+			return false;
+		}
+	}
+
+	// The previous merge is still referenced by published snapshots and must not see the patch.
+	TestEqual(TEXT("Previous merge keeps its entries"), FirstMerged->Num(), NumBaseEntries);
+	TestEqual(TEXT("Previous merge keeps the old translation"), FindTranslation(*FirstMerged, 1000), FString(TEXT("Base 1000")));
+	TestEqual(TEXT("Previous merge keeps the removed entry"), FindTranslation(*FirstMerged, 2000), FString(TEXT("Base 2000")));
+
+	// Entries the last layer stops translating fall back to the earlier layer.
+	LayeredIndex.SetLayer(1, MakeLayer(1, NumOverriddenEntries - 1, TEXT("Dlc")));
+	const FTolgeeCultureIndexRef ThirdMerged = LayeredIndex.GetMerged();
+	TestEqual(TEXT("Fallback to the base layer"), FindTranslation(*ThirdMerged, 0), FString(TEXT("Base 0")));
+	TestEqual(TEXT("Entry still translated by the last layer"), FindTranslation(*ThirdMerged, 7), FString(TEXT("Dlc 7")));
+	TestEqual(TEXT("Entries after the last layer update"), ThirdMerged->Num(), NumBaseEntries - 1);
+
+	AddInfo(FString::Printf(TEXT("Updating the base layer of a %d entry merge with 3 changed entries took %.3f ms."), NumBaseEntries, PatchTime * 1000.0));
+
+	return true;
+}
+
+#endif
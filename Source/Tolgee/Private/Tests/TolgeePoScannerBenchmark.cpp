@@ -0,0 +1,122 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/PlatformTime.h>
+
+#include "TolgeePoScanner.h"
+#include "TolgeeTestCorpus.h"
+
+namespace
+{
+	constexpr int32 NumCorpusEntries = 20000;
+	constexpr int32 NumBenchmarkRuns = 5;
+
+	/**
+	 * Byte by byte reference the vectorized kernels are checked and compared against.
+	 */
+	const uint8* FindStringDelimiterScalar(const uint8* Begin, const uint8* End)
+	{
+		while (Begin < End && *Begin != '"' && *Begin != '\\' && *Begin != '\n')
+		{
+			++Begin;
+		}
+		return Begin;
+	}
+
+	const uint8* FindNonAsciiScalar(const uint8* Begin, const uint8* End)
+	{
+		while (Begin < End && *Begin < 0x80)
+		{
+			++Begin;
+		}
+		return Begin;
+	}
+
+	/**
+	 * Runs the scan over the whole corpus, restarting right after every match like the tokenizer does. Returns the number of matches.
+	 */
+	template <typename ScanFunction>
+	int32 ScanCorpus(const TArray<uint8>& Corpus, ScanFunction Scan)
+	{
+		int32 NumMatches = 0;
+		const uint8* Cursor = Corpus.GetData();
+		const uint8* End = Cursor + Corpus.Num();
+		while ((Cursor = Scan(Cursor, End)) < End)
+		{
+			NumMatches++;
+			Cursor++;
+		}
+		return NumMatches;
+	}
+
+	/**
+	 * Returns the best throughput (MB/s) of the scan over the corpus.
+	 */
+	template <typename ScanFunction>
+	double MeasureThroughput(const TArray<uint8>& Corpus, ScanFunction Scan)
+	{
+		double BestTime = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < NumBenchmarkRuns; ++Run)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Scan();
+			BestTime = FMath::Min(BestTime, FPlatformTime::Seconds() - StartTime);
+		}
+		return Corpus.Num() / (1024.0 * 1024.0) / FMath::Max(BestTime, UE_SMALL_NUMBER);
+	}
+} // namespace
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FTolgeePoScannerBenchmarkTest, "Tolgee.Runtime.PoScanner.Throughput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FTolgeePoScannerBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const ETolgeeTestScript Script : {ETolgeeTestScript::Latin, ETolgeeTestScript::Cjk, ETolgeeTestScript::Arabic})
+	{
+		OutBeautifiedNames.Add(TolgeeTestCorpus::GetScriptName(Script));
+		OutTestCommands.Add(FString::FromInt(static_cast<int32>(Script)));
+	}
+}
+
+bool FTolgeePoScannerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const ETolgeeTestScript Script = static_cast<ETolgeeTestScript>(FCString::Atoi(*Parameters));
+	const TArray<uint8> Corpus = TolgeeTestCorpus::MakePoContent(Script, NumCorpusEntries);
+	const uint8* Begin = Corpus.GetData();
+	const uint8* End = Begin + Corpus.Num();
+
+	// The kernel has to agree with the reference everywhere, including the unaligned tails.
+	TestEqual(TEXT("FindStringDelimiter matches"), ScanCorpus(Corpus, &TolgeePoScanner::FindStringDelimiter), ScanCorpus(Corpus, &FindStringDelimiterScalar));
+	TestEqual(TEXT("FindNonAscii matches"), ScanCorpus(Corpus, &TolgeePoScanner::FindNonAscii), ScanCorpus(Corpus, &FindNonAsciiScalar));
+	TestTrue(TEXT("Corpus is valid UTF-8"), TolgeePoScanner::IsValidUtf8(Begin, End));
+	for (int32 Offset = 0; Offset < 64; ++Offset)
+	{
+		TestEqual(TEXT("FindStringDelimiter at offset"), static_cast<int32>(TolgeePoScanner::FindStringDelimiter(Begin + Offset, End) - Begin), static_cast<int32>(FindStringDelimiterScalar(Begin + Offset, End) - Begin));
+		TestEqual(TEXT("FindNonAscii at offset"), static_cast<int32>(TolgeePoScanner::FindNonAscii(Begin + Offset, End) - Begin), static_cast<int32>(FindNonAsciiScalar(Begin + Offset, End) - Begin));
+	}
+
+	const TArray<uint8> AsciiCorpus = TolgeeTestCorpus::MakePoContent(ETolgeeTestScript::Latin, NumCorpusEntries / 4).FilterByPredicate([](uint8 Char) { return Char < 0x80; });
+	TArray<TCHAR> Widened;
+	Widened.SetNumUninitialized(AsciiCorpus.Num());
+
+	const double DelimiterThroughput = MeasureThroughput(Corpus, [&Corpus]() { ScanCorpus(Corpus, &TolgeePoScanner::FindStringDelimiter); });
+	const double DelimiterScalarThroughput = MeasureThroughput(Corpus, [&Corpus]() { ScanCorpus(Corpus, &FindStringDelimiterScalar); });
+	const double NonAsciiThroughput = MeasureThroughput(Corpus, [&Corpus]() { ScanCorpus(Corpus, &TolgeePoScanner::FindNonAscii); });
+	const double NonAsciiScalarThroughput = MeasureThroughput(Corpus, [&Corpus]() { ScanCorpus(Corpus, &FindNonAsciiScalar); });
+	const double Utf8Throughput = MeasureThroughput(Corpus, [Begin, End]() { TolgeePoScanner::IsValidUtf8(Begin, End); });
+	const double WidenThroughput = MeasureThroughput(AsciiCorpus, [&AsciiCorpus, &Widened]() { TolgeePoScanner::WidenAscii(AsciiCorpus.GetData(), AsciiCorpus.Num(), Widened.GetData()); });
+
+	const TCHAR* KernelName = TolgeePoScanner::GetKernelName();
+	const TCHAR* ScriptName = TolgeeTestCorpus::GetScriptName(Script);
+	AddInfo(FString::Printf(TEXT("[%s] %s corpus: %.1f MB"), KernelName, ScriptName, Corpus.Num() / (1024.0 * 1024.0)));
+	AddInfo(FString::Printf(TEXT("[%s] %s FindStringDelimiter: %.0f MB/s (scalar %.0f MB/s)"), KernelName, ScriptName, DelimiterThroughput, DelimiterScalarThroughput));
+	AddInfo(FString::Printf(TEXT("[%s] %s FindNonAscii: %.0f MB/s (scalar %.0f MB/s)"), KernelName, ScriptName, NonAsciiThroughput, NonAsciiScalarThroughput));
+	AddInfo(FString::Printf(TEXT("[%s] %s IsValidUtf8: %.0f MB/s"), KernelName, ScriptName, Utf8Throughput));
+	AddInfo(FString::Printf(TEXT("[%s] WidenAscii: %.0f MB/s"), KernelName, WidenThroughput));
+
+	return true;
+}
+
+#endif
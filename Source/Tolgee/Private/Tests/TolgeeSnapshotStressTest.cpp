@@ -0,0 +1,221 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Algo/AllOf.h>
+#include <Async/Async.h>
+#include <HAL/PlatformTime.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeRefreshScheduler.h"
+#include "TolgeeTranslationSnapshot.h"
+
+namespace
+{
+	constexpr int32 NumWriterThreads = 2;
+	constexpr int32 NumReaderThreads = 4;
+	constexpr int32 NumEntriesPerCulture = 16;
+	constexpr int32 MaxSnapshots = 1 << 20;
+	constexpr double StressDuration = 2.0;
+
+	/**
+	 * Everything shared between the publishing threads, the reading threads and the game thread driving the refreshes.
+	 */
+	struct FStressState
+	{
+		TAtomic<bool> bStop;
+		TAtomic<int32> NextStamp;
+		TAtomic<int32> NumDestroyed;
+		TAtomic<int32> NumAcquired;
+		TAtomic<int32> NumTorn;
+		TAtomic<int32> NumFreed;
+		TAtomic<int32> NumRefreshesQueued;
+		/**
+		 * Set by the deleter of every snapshot, a reader holding a reference must never see it set.
+		 */
+		TArray<TAtomic<bool>> Destroyed;
+		TArray<TFuture<void>> Threads;
+		double StartTime = 0.0;
+		/**
+		 * Declared last so the snapshots it still holds are destroyed while the counters they update are alive.
+		 */
+		FTolgeeSnapshotPublisher Publisher;
+
+		FStressState() :
+			bStop(false),
+			NextStamp(0),
+			NumDestroyed(0),
+			NumAcquired(0),
+			NumTorn(0),
+			NumFreed(0),
+			NumRefreshesQueued(0)
+		{
+			Destroyed.SetNum(MaxSnapshots);
+			for (TAtomic<bool>& bDestroyed : Destroyed)
+			{
+				bDestroyed = false;
+			}
+		}
+	};
+
+	/**
+	 * Culture whose entries all carry the stamp, in the source string hash and in the translation.
+	 */
+	FTolgeeCultureIndexRef MakeStampedCulture(int32 Stamp)
+	{
+		FTolgeeCultureIndexBuilder Builder;
+		Builder.Reserve(NumEntriesPerCulture);
+		for (int32 EntryIndex = 0; EntryIndex < NumEntriesPerCulture; ++EntryIndex)
+		{
+			Builder.Add(FTextId(FTextKey(TEXT("Stress")), FTextKey(FString::FromInt(EntryIndex))), Stamp, FString::FromInt(Stamp));
+		}
+		return Builder.Build();
+	}
+
+	void PublishStampedSnapshot(FStressState& State, int32 Stamp)
+	{
+		FTolgeeTranslationSnapshot* Snapshot = new FTolgeeTranslationSnapshot();
+		Snapshot->Cultures.Add(TEXT("de"), MakeStampedCulture(Stamp));
+		Snapshot->Cultures.Add(TEXT("fr"), MakeStampedCulture(Stamp));
+
+		State.Publisher.Publish(TSharedPtr<FTolgeeTranslationSnapshot, ESPMode::ThreadSafe>(MakeShareable(Snapshot, [&State, Stamp](FTolgeeTranslationSnapshot* DestroyedSnapshot)
+		{
+			State.Destroyed[Stamp] = true;
+			++State.NumDestroyed;
+			delete DestroyedSnapshot;
+		})));
+	}
+
+	/**
+	 * Returns true if every culture of the snapshot carries the same stamp in every entry.
+	 */
+	bool IsConsistent(const FTolgeeTranslationSnapshot& Snapshot, int32& OutStamp)
+	{
+		const FTolgeeCultureIndexRef* German = Snapshot.Cultures.Find(TEXT("de"));
+		const FTolgeeCultureIndexRef* French = Snapshot.Cultures.Find(TEXT("fr"));
+		if (Snapshot.Cultures.Num() != 2 || !German || !French || (*German)->Num() == 0)
+		{
+			return false;
+		}
+
+		OutStamp = static_cast<int32>((*German)->GetSourceStringHash(0));
+		if (OutStamp < 0 || OutStamp >= MaxSnapshots)
+		{
+			return false;
+		}
+
+		const FString ExpectedTranslation = FString::FromInt(OutStamp);
+		for (const FTolgeeCultureIndexRef* Culture : {German, French})
+		{
+			if ((*Culture)->Num() != NumEntriesPerCulture)
+			{
+				return false;
+			}
+			for (int32 EntryIndex = 0; EntryIndex < NumEntriesPerCulture; ++EntryIndex)
+			{
+				if ((*Culture)->GetSourceStringHash(EntryIndex) != static_cast<uint32>(OutStamp) || !(*Culture)->GetTranslation(EntryIndex).Equals(ExpectedTranslation, ESearchCase::CaseSensitive))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeSnapshotStressTest, "Tolgee.Runtime.Snapshot.Stress", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+bool FTolgeeSnapshotStressTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FStressState> State = MakeShared<FStressState>();
+
+	PublishStampedSnapshot(*State, State->NextStamp++);
+
+	for (int32 WriterIndex = 0; WriterIndex < NumWriterThreads; ++WriterIndex)
+	{
+		State->Threads.Add(Async(EAsyncExecution::Thread, [State]()
+		{
+			while (!State->bStop)
+			{
+				const int32 Stamp = State->NextStamp++;
+				if (Stamp >= MaxSnapshots)
+				{
+					return;
+				}
+				PublishStampedSnapshot(*State, Stamp);
+			}
+		}));
+	}
+
+	for (int32 ReaderIndex = 0; ReaderIndex < NumReaderThreads; ++ReaderIndex)
+	{
+		State->Threads.Add(Async(EAsyncExecution::Thread, [State]()
+		{
+			while (!State->bStop)
+			{
+				const FTolgeeTranslationSnapshotPtr Snapshot = State->Publisher.Acquire();
+				++State->NumAcquired;
+
+				int32 Stamp = INDEX_NONE;
+				if (!Snapshot || !IsConsistent(*Snapshot, Stamp))
+				{
+					++State->NumTorn;
+				}
+				else if (State->Destroyed[Stamp])
+				{
+					++State->NumFreed;
+				}
+			}
+		}));
+	}
+
+	// The game thread keeps requesting refreshes while the other threads publish and read, so refreshes run on the workers during the whole test.
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]()
+	{
+		if (State->StartTime == 0.0)
+		{
+			State->StartTime = FPlatformTime::Seconds();
+		}
+
+		FTolgeeRefreshScheduler::Get().QueueRefresh();
+		++State->NumRefreshesQueued;
+
+		if (FPlatformTime::Seconds() - State->StartTime < StressDuration && State->NextStamp < MaxSnapshots)
+		{
+			return false;
+		}
+
+		State->bStop = true;
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]()
+	{
+		return FTolgeeRefreshScheduler::Get().IsIdle() && Algo::AllOf(State->Threads, [](const TFuture<void>& Thread) { return Thread.IsReady(); });
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestTrue(TEXT("Snapshots were read"), State->NumAcquired > 0);
+		TestEqual(TEXT("Torn snapshots"), static_cast<int32>(State->NumTorn), 0);
+		TestEqual(TEXT("Snapshots read after being destroyed"), static_cast<int32>(State->NumFreed), 0);
+
+		// Both slots of the publisher keep a snapshot alive, every other one has to be destroyed already.
+		const int32 NumPublished = FMath::Min(static_cast<int32>(State->NextStamp), MaxSnapshots);
+		TestTrue(TEXT("Only the snapshots held by the publisher are alive"), NumPublished - State->NumDestroyed <= 2);
+
+		State->Publisher.Publish(nullptr);
+		State->Publisher.Publish(nullptr);
+		TestEqual(TEXT("Every snapshot destroyed"), static_cast<int32>(State->NumDestroyed), NumPublished);
+
+		AddInfo(FString::Printf(TEXT("Published %d snapshots, acquired %d, queued %d refreshes in %.1f s."), NumPublished, static_cast<int32>(State->NumAcquired), static_cast<int32>(State->NumRefreshesQueued), StressDuration));
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
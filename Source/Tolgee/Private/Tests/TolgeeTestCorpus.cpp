@@ -0,0 +1,135 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeTestCorpus.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Containers/StringConv.h>
+#include <Math/RandomStream.h>
+
+namespace
+{
+	/**
+	 * Code point ranges the generated words are made of, per script.
+	 */
+	void GetScriptRange(ETolgeeTestScript Script, TCHAR& OutFirst, TCHAR& OutLast)
+	{
+		switch (Script)
+		{
+			case ETolgeeTestScript::Cjk:
+				OutFirst = 0x4E00;
+				OutLast = 0x9FA5;
+				break;
+			case ETolgeeTestScript::Arabic:
+				OutFirst = 0x0621;
+				OutLast = 0x064A;
+				break;
+			default:
+				OutFirst = 'a';
+				OutLast = 'z';
+				break;
+		}
+	}
+
+	void AppendEscaped(const FString& Text, FString& Out)
+	{
+		for (const TCHAR Char : Text)
+		{
+			switch (Char)
+			{
+				case '"':
+					Out.Append(TEXT("\\\""));
+					break;
+				case '\\':
+					Out.Append(TEXT("\\\\"));
+					break;
+				case '\n':
+					Out.Append(TEXT("\\n"));
+					break;
+				default:
+					Out.AppendChar(Char);
+					break;
+			}
+		}
+	}
+} // namespace
+
+const TCHAR* TolgeeTestCorpus::GetScriptName(ETolgeeTestScript Script)
+{
+	switch (Script)
+	{
+		case ETolgeeTestScript::Cjk:
+			return TEXT("CJK");
+		case ETolgeeTestScript::Arabic:
+			return TEXT("Arabic");
+		default:
+			return TEXT("Latin");
+	}
+}
+
+FString TolgeeTestCorpus::MakeText(ETolgeeTestScript Script, int32 Seed, int32 Length)
+{
+	TCHAR First;
+	TCHAR Last;
+	GetScriptRange(Script, First, Last);
+
+	FRandomStream Random(Seed);
+
+	FString Result;
+	Result.Reserve(Length);
+	while (Result.Len() < Length)
+	{
+		const int32 Roll = Random.RandRange(0, 99);
+		if (Roll < 12)
+		{
+			Result.AppendChar(' ');
+		}
+		else if (Roll == 12)
+		{
+			Result.AppendChar('"');
+		}
+		else if (Roll == 13)
+		{
+			Result.AppendChar('\n');
+		}
+		else if (Roll == 14)
+		{
+			Result.AppendChar('\\');
+		}
+		else
+		{
+			Result.AppendChar(static_cast<TCHAR>(Random.RandRange(First, Last)));
+		}
+	}
+
+	return Result;
+}
+
+FString TolgeeTestCorpus::GetNamespace(int32 EntryIndex)
+{
+	return FString::Printf(TEXT("Namespace%d"), EntryIndex % 16);
+}
+
+FString TolgeeTestCorpus::GetKey(int32 EntryIndex)
+{
+	return FString::Printf(TEXT("Key%d"), EntryIndex);
+}
+
+TArray<uint8> TolgeeTestCorpus::MakePoContent(ETolgeeTestScript Script, int32 NumEntries)
+{
+	FString Content = TEXT("msgid \"\"\nmsgstr \"\"\n\"Content-Type: text/plain; charset=UTF-8\\n\"\n\n");
+
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		Content.Appendf(TEXT("msgctxt \"%s,%s\"\nmsgid \""), *GetNamespace(EntryIndex), *GetKey(EntryIndex));
+		AppendEscaped(MakeText(ETolgeeTestScript::Latin, EntryIndex, 24), Content);
+		Content.Append(TEXT("\"\nmsgstr \""));
+		AppendEscaped(MakeText(Script, EntryIndex, 48), Content);
+		Content.Append(TEXT("\"\n\n"));
+	}
+
+	const FTCHARToUTF8 Utf8Content(*Content, Content.Len());
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8Content.Get()), Utf8Content.Length());
+}
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Writing systems used to generate the synthetic corpora, each one stresses a different part of the UTF-8 handling.
+ */
+enum class ETolgeeTestScript : uint8
+{
+	Latin,
+	Cjk,
+	Arabic
+};
+
+/**
+ * Deterministic synthetic PO content shared by the runtime tests and benchmarks.
+ */
+namespace TolgeeTestCorpus
+{
+	/**
+	 * @brief Name of the script, used in the test reports
+	 */
+	const TCHAR* GetScriptName(ETolgeeTestScript Script);
+	/**
+	 * @brief Text of the given length written in the script. Contains a few quotes, backslashes and line feeds the PO format has to escape.
+	 */
+	FString MakeText(ETolgeeTestScript Script, int32 Seed, int32 Length);
+	/**
+	 * @brief Namespace of the entry at the given position of MakePoContent
+	 */
+	FString GetNamespace(int32 EntryIndex);
+	/**
+	 * @brief Key of the entry at the given position of MakePoContent
+	 */
+	FString GetKey(int32 EntryIndex);
+	/**
+	 * @brief UTF-8 PO file in the Unreal format (msgctxt "Namespace,Key") with NumEntries translated entries
+	 */
+	TArray<uint8> MakePoContent(ETolgeeTestScript Script, int32 NumEntries);
+} // namespace TolgeeTestCorpus
+
+#endif
@@ -0,0 +1,174 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeCdnCache.h"
+
+#include <Dom/JsonObject.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Misc/SecureHash.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <Serialization/JsonWriter.h>
+
+#include "TolgeeCultureIndexFile.h"
+#include "TolgeeLog.h"
+#include "TolgeeRuntimeSettings.h"
+
+namespace
+{
+	FString GetBasePath(const FString& Directory, const FString& Url)
+	{
+		return Directory / FMD5::HashAnsiString(*Url);
+	}
+
+	FString GetContentPath(const FString& Directory, const FString& Url)
+	{
+		return GetBasePath(Directory, Url) + TEXT(".bin");
+	}
+
+	FString GetEntryPath(const FString& Directory, const FString& Url)
+	{
+		return GetBasePath(Directory, Url) + TEXT(".json");
+	}
+
+	/**
+	 * Directories searched when loading, the cache written at runtime takes precedence over the baked baseline.
+	 */
+	TArray<FString, TInlineAllocator<2>> GetLoadDirectories()
+	{
+		return {TolgeeCdnCache::GetCacheDirectory(), TolgeeCdnCache::GetBakedDirectory()};
+	}
+} // namespace
+
+FString TolgeeCdnCache::GetCacheDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Tolgee") / TEXT("Cdn");
+}
+
+FString TolgeeCdnCache::GetBakedDirectory()
+{
+	return FPaths::ProjectContentDir() / TEXT("Tolgee") / TEXT("Baked");
+}
+
+FString TolgeeCdnCache::GetFileUrl(const FString& CdnAddress, const FString& Culture)
+{
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	return FString::Printf(TEXT("%s/%s.%s"), *CdnAddress, *Culture, Settings->bUsePrecompressedFiles ? TEXT("po.gz") : TEXT("po"));
+}
+
+TArray<FTolgeeCdnCacheEntry> TolgeeCdnCache::GetFiles(const TArray<FString>& Cultures)
+{
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+
+	// NOTE: Mirrors serve the same files, so they are identified (and cached) by the url of the first address.
+	TArray<FString> CdnAddresses = Settings->CdnAddresses;
+	if (Settings->bCdnAddressesAreMirrors && CdnAddresses.Num() > 1)
+	{
+		CdnAddresses.SetNum(1);
+	}
+
+	TArray<FTolgeeCdnCacheEntry> Files;
+	for (int32 Layer = 0; Layer < CdnAddresses.Num(); ++Layer)
+	{
+		for (const FString& Culture : Cultures)
+		{
+			FTolgeeCdnCacheEntry& File = Files.AddDefaulted_GetRef();
+			File.Url = GetFileUrl(CdnAddresses[Layer], Culture);
+			File.Culture = Culture;
+			File.Layer = Layer;
+		}
+	}
+
+	return Files;
+}
+
+bool TolgeeCdnCache::LoadEntry(const FString& Url, FTolgeeCdnCacheEntry& OutEntry)
+{
+	FString EntryContent;
+	bool bFoundEntry = false;
+	for (const FString& Directory : GetLoadDirectories())
+	{
+		if (FFileHelper::LoadFileToString(EntryContent, *GetEntryPath(Directory, Url)))
+		{
+			bFoundEntry = true;
+			break;
+		}
+	}
+	if (!bFoundEntry)
+	{
+		return false;
+	}
+
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(EntryContent);
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to read cached CDN entry for %s."), *Url);
+		return false;
+	}
+
+	// NOTE: Different urls could in theory end up with the same hash, make sure the entry belongs to the requested one.
+	if (JsonObject->GetStringField(TEXT("url")) != Url)
+	{
+		return false;
+	}
+
+	OutEntry.Url = Url;
+	OutEntry.Culture = JsonObject->GetStringField(TEXT("culture"));
+	OutEntry.LastModified = JsonObject->GetStringField(TEXT("lastModified"));
+	OutEntry.ETag = JsonObject->GetStringField(TEXT("etag"));
+	JsonObject->TryGetStringField(TEXT("hash"), OutEntry.ContentHash);
+	JsonObject->TryGetNumberField(TEXT("size"), OutEntry.ContentSize);
+	return true;
+}
+
+TOptional<FTolgeeCultureIndexRef> TolgeeCdnCache::LoadTranslations(const FTolgeeCdnCacheEntry& Entry)
+{
+	// NOTE: The content hash ties the translations to the entry, so an entry is never paired with translations from the other directory.
+	for (const FString& Directory : GetLoadDirectories())
+	{
+		TOptional<FTolgeeCultureIndexRef> Translations = TolgeeCultureIndexFile::Load(GetContentPath(Directory, Entry.Url), Entry.ContentHash);
+		if (Translations.IsSet())
+		{
+			return Translations;
+		}
+	}
+
+	return {};
+}
+
+FString TolgeeCdnCache::HashContent(TConstArrayView<uint8> Content)
+{
+	FSHAHash Hash;
+	FSHA1::HashBuffer(Content.GetData(), Content.Num(), Hash.Hash);
+	return Hash.ToString();
+}
+
+bool TolgeeCdnCache::Save(const FTolgeeCdnCacheEntry& Entry, const FTolgeeCultureIndex& Translations, const FString& Directory)
+{
+	if (!TolgeeCultureIndexFile::Save(GetContentPath(Directory, Entry.Url), Translations, Entry.ContentHash))
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to write cached CDN content for %s."), *Entry.Url);
+		return false;
+	}
+
+	const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("url"), Entry.Url);
+	JsonObject->SetStringField(TEXT("culture"), Entry.Culture);
+	JsonObject->SetStringField(TEXT("lastModified"), Entry.LastModified);
+	JsonObject->SetStringField(TEXT("etag"), Entry.ETag);
+	JsonObject->SetStringField(TEXT("hash"), Entry.ContentHash);
+	JsonObject->SetNumberField(TEXT("size"), Entry.ContentSize);
+
+	FString EntryContent;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&EntryContent);
+	FJsonSerializer::Serialize(JsonObject, JsonWriter);
+
+	if (!FFileHelper::SaveStringToFile(EntryContent, *GetEntryPath(Directory, Entry.Url)))
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to write cached CDN entry for %s."), *Entry.Url);
+		return false;
+	}
+
+	return true;
+}
@@ -2,12 +2,34 @@
 
 #include "TolgeeCdnFetcherSubsystem.h"
 
+#include <Algo/AnyOf.h>
+#include <Async/Async.h>
+#include <Async/ParallelFor.h>
+#include <Dom/JsonObject.h>
+#include <Engine/GameInstance.h>
 #include <HttpModule.h>
 #include <Interfaces/IHttpResponse.h>
+#include <Internationalization/Culture.h>
+#include <Internationalization/Internationalization.h>
 #include <Kismet/KismetInternationalizationLibrary.h>
+#include <Misc/CoreDelegates.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
 
+#include "TolgeeCdnCache.h"
+#include "TolgeeCultureIndex.h"
 #include "TolgeeRuntimeSettings.h"
 #include "TolgeeLog.h"
+#include "TolgeePoParser.h"
+#include "TolgeeUtils.h"
+
+namespace
+{
+	/**
+	 * Latency recorded for a mirror that failed to answer, so it is tried last next time.
+	 */
+	constexpr double FailedMirrorLatency = 30.0;
+} // namespace
 
 void UTolgeeCdnFetcherSubsystem::OnGameInstanceStart(UGameInstance* GameInstance)
 {
@@ -23,96 +45,671 @@ void UTolgeeCdnFetcherSubsystem::OnGameInstanceStart(UGameInstance* GameInstance
 		return;
 	}
 
-	FetchAllCdns();
+	ActiveGameInstance = GameInstance;
+	if (Settings->bCdnAddressesAreMirrors)
+	{
+		LatencyStats.Load();
+	}
+
+	FInternationalization::Get().OnCultureChanged().AddUObject(this, &ThisClass::OnCultureChanged);
+	FCoreDelegates::ApplicationWillDeactivateDelegate.AddUObject(this, &ThisClass::OnApplicationDeactivated);
+	FCoreDelegates::ApplicationHasReactivatedDelegate.AddUObject(this, &ThisClass::OnApplicationReactivated);
+
+	CurrentPollingInterval = Settings->PollingInterval;
+	bPollingPaused = false;
+
+	const TArray<FString> Cultures = Settings->FetchPolicy == ETolgeeCdnFetchPolicy::AllCultures ? UKismetInternationalizationLibrary::GetLocalizedCultures() : GetActiveCultures();
+	LoadCultures(Cultures);
+
+	if (Settings->FetchPolicy == ETolgeeCdnFetchPolicy::ActiveCulturesFirst)
+	{
+		PrefetchQueue = UKismetInternationalizationLibrary::GetLocalizedCultures();
+		PrefetchQueue.RemoveAll([&Cultures](const FString& Culture) { return Cultures.Contains(Culture); });
+	}
 }
 
 void UTolgeeCdnFetcherSubsystem::OnGameInstanceEnd(bool bIsSimulating)
 {
+	FInternationalization::Get().OnCultureChanged().RemoveAll(this);
+	FCoreDelegates::ApplicationWillDeactivateDelegate.RemoveAll(this);
+	FCoreDelegates::ApplicationHasReactivatedDelegate.RemoveAll(this);
+
 	ResetData();
+	ActiveGameInstance.Reset();
+
+	CacheEntries.Empty();
+}
+
+void UTolgeeCdnFetcherSubsystem::OnCultureChanged()
+{
+	LoadCultures(GetActiveCultures());
+}
+
+TArray<FString> UTolgeeCdnFetcherSubsystem::GetActiveCultures() const
+{
+	const FString CurrentLanguage = FInternationalization::Get().GetCurrentLanguage()->GetName();
+	const TArray<FString> LocalizedCultures = UKismetInternationalizationLibrary::GetLocalizedCultures();
+
+	TArray<FString> ActiveCultures;
+	for (const FString& Culture : FInternationalization::Get().GetPrioritizedCultureNames(CurrentLanguage))
+	{
+		if (LocalizedCultures.Contains(Culture))
+		{
+			ActiveCultures.Add(Culture);
+		}
+	}
+
+	return ActiveCultures;
+}
+
+void UTolgeeCdnFetcherSubsystem::LoadCultures(const TArray<FString>& Cultures)
+{
+	TArray<FString> NewCultures;
+	for (const FString& Culture : Cultures)
+	{
+		bool bAlreadyRequested = false;
+		RequestedCultures.Add(Culture, &bAlreadyRequested);
+		if (!bAlreadyRequested)
+		{
+			NewCultures.Add(Culture);
+		}
+	}
+
+	if (NewCultures.IsEmpty())
+	{
+		return;
+	}
 
-	LastModifiedDates.Empty();
+	UE_LOG(LogTolgee, Display, TEXT("Loading CDN data for cultures: %s"), *FString::Join(NewCultures, TEXT(", ")));
+	LoadCachedData(TolgeeCdnCache::GetFiles(NewCultures));
 }
 
-TMap<FString, TArray<FTolgeeTranslationData>> UTolgeeCdnFetcherSubsystem::GetDataToInject() const
+void UTolgeeCdnFetcherSubsystem::LoadCachedData(const TArray<FTolgeeCdnCacheEntry>& Files)
 {
-	return CachedTranslations;
+	// NOTE: Loading the cached files happens on a worker thread, the network revalidation starts once the cache was injected.
+	AsyncTask(
+		ENamedThreads::AnyBackgroundThreadNormalTask,
+		[WeakThis = TWeakObjectPtr<ThisClass>(this), Files, Generation = FetchGeneration]() mutable
+		{
+			TArray<TOptional<FTolgeeCultureIndexRef>> Translations;
+			Translations.SetNum(Files.Num());
+
+			ParallelFor(
+				Files.Num(),
+				[&Files, &Translations](int32 Index)
+				{
+					if (TolgeeCdnCache::LoadEntry(Files[Index].Url, Files[Index]))
+					{
+						Translations[Index] = TolgeeCdnCache::LoadTranslations(Files[Index]);
+					}
+				}
+			);
+
+			AsyncTask(
+				ENamedThreads::GameThread,
+				[WeakThis, Files = MoveTemp(Files), Translations = MoveTemp(Translations), Generation]()
+				{
+					if (WeakThis.IsValid())
+					{
+						WeakThis->OnCachedDataLoaded(Files, Translations, Generation);
+					}
+				}
+			);
+		}
+	);
 }
 
-void UTolgeeCdnFetcherSubsystem::FetchAllCdns()
+void UTolgeeCdnFetcherSubsystem::OnCachedDataLoaded(const TArray<FTolgeeCdnCacheEntry>& Files, const TArray<TOptional<FTolgeeCultureIndexRef>>& Translations, int32 Generation)
+{
+	if (Generation != FetchGeneration)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding cached translations loaded for a previous session."));
+		return;
+	}
+
+	int32 NumCachedFiles = 0;
+	for (int32 Index = 0; Index < Files.Num(); ++Index)
+	{
+		if (Translations[Index].IsSet())
+		{
+			CacheEntries.Emplace(Files[Index].Url, Files[Index]);
+			MergeTranslations(Files[Index], Translations[Index].GetValue());
+			NumCachedFiles++;
+		}
+	}
+
+	if (NumCachedFiles > 0)
+	{
+		UE_LOG(LogTolgee, Display, TEXT("Injecting %d cached CDN files before revalidating."), NumCachedFiles);
+		PublishTranslations(CachedTranslations);
+		QueueRefresh();
+	}
+
+	FetchCdnFiles(Files);
+}
+
+void UTolgeeCdnFetcherSubsystem::FetchCdnFiles(const TArray<FTolgeeCdnCacheEntry>& Files)
 {
 	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
 
-	for (const FString& CdnAddress : Settings->CdnAddresses)
+	if (Settings->bUseManifest)
 	{
-		TArray<FString> Cultures = UKismetInternationalizationLibrary::GetLocalizedCultures();
-		for (const FString& Culture : Cultures)
+		TMap<int32, TArray<FTolgeeCdnCacheEntry>> FilesPerLayer;
+		for (const FTolgeeCdnCacheEntry& File : Files)
 		{
-			const FString DownloadUrl = FString::Printf(TEXT("%s/%s.po"), *CdnAddress, *Culture);
+			FilesPerLayer.FindOrAdd(File.Layer).Add(File);
+		}
 
-			UE_LOG(LogTolgee, Display, TEXT("Fetching localization data for culture: %s from CDN: %s"), *Culture, *DownloadUrl);
-			FetchFromCdn(Culture, DownloadUrl);
+		for (const TPair<int32, TArray<FTolgeeCdnCacheEntry>>& LayerFiles : FilesPerLayer)
+		{
+			FetchManifest(Settings->CdnAddresses[LayerFiles.Key], LayerFiles.Value);
 		}
-	};
+		return;
+	}
 
+	for (const FTolgeeCdnCacheEntry& File : Files)
+	{
+		FetchFile(File);
+	}
 }
 
-void UTolgeeCdnFetcherSubsystem::FetchFromCdn(const FString& Culture, const FString& DownloadUrl)
+void UTolgeeCdnFetcherSubsystem::FetchFile(const FTolgeeCdnCacheEntry& File)
 {
-	const FString* LastModifiedDate = LastModifiedDates.Find(DownloadUrl);
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	if (Settings->bCdnAddressesAreMirrors && Settings->CdnAddresses.Num() > 1)
+	{
+		FetchFromMirrors(File);
+		return;
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("Fetching localization data for culture: %s from CDN: %s"), *File.Culture, *File.Url);
+	FetchFromCdn(File);
+}
+
+void UTolgeeCdnFetcherSubsystem::FetchManifest(const FString& CdnAddress, const TArray<FTolgeeCdnCacheEntry>& Files)
+{
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	const FString ManifestUrl = FString::Printf(TEXT("%s/%s"), *CdnAddress, *Settings->ManifestFileName);
+
+	UE_LOG(LogTolgee, Verbose, TEXT("Fetching CDN manifest: %s"), *ManifestUrl);
 
 	const FHttpRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetVerb("GET");
-	HttpRequest->SetURL(DownloadUrl);
+	HttpRequest->SetURL(ManifestUrl);
 	HttpRequest->SetHeader(TEXT("accept"), TEXT("application/json"));
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedManifest, Files, FetchGeneration);
+	HttpRequest->ProcessRequest();
+
+	NumRequestsSent++;
+}
+
+void UTolgeeCdnFetcherSubsystem::OnFetchedManifest(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TArray<FTolgeeCdnCacheEntry> Files, int32 Generation)
+{
+	if (Generation != FetchGeneration)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding CDN manifest %s requested for a previous session."), *Request->GetURL());
+		return;
+	}
+
+	TSharedPtr<FJsonObject> ManifestFiles;
+	if (bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedPtr<FJsonObject>* JsonFiles = nullptr;
+		if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid() && JsonObject->TryGetObjectField(TEXT("files"), JsonFiles))
+		{
+			ManifestFiles = *JsonFiles;
+		}
+	}
+
+	if (!ManifestFiles.IsValid())
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to read CDN manifest %s, fetching all files instead."), *Request->GetURL());
+	}
+
+	int32 NumUpToDateFiles = 0;
+	for (const FTolgeeCdnCacheEntry& File : Files)
+	{
+		if (ManifestFiles.IsValid() && IsUpToDate(File, *ManifestFiles))
+		{
+			NumUpToDateFiles++;
+			continue;
+		}
+
+		FetchFile(File);
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("CDN manifest %s checked, %d of %d files are up to date."), *Request->GetURL(), NumUpToDateFiles, Files.Num());
+
+	OnRequestCompleted();
+}
+
+bool UTolgeeCdnFetcherSubsystem::IsUpToDate(const FTolgeeCdnCacheEntry& File, const FJsonObject& ManifestFiles) const
+{
+	const FTolgeeCdnCacheEntry* CacheEntry = CacheEntries.Find(File.Url);
+	if (!CacheEntry || CacheEntry->ContentHash.IsEmpty())
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* ManifestFile = nullptr;
+	if (!ManifestFiles.TryGetObjectField(File.Culture, ManifestFile))
+	{
+		return false;
+	}
+
+	FString Hash;
+	if (!(*ManifestFile)->TryGetStringField(TEXT("hash"), Hash) || !Hash.Equals(CacheEntry->ContentHash, ESearchCase::IgnoreCase))
+	{
+		return false;
+	}
 
-	if (LastModifiedDate)
+	int64 Size = 0;
+	if ((*ManifestFile)->TryGetNumberField(TEXT("size"), Size) && Size != CacheEntry->ContentSize)
 	{
-		HttpRequest->SetHeader(TEXT("If-Modified-Since"), *LastModifiedDate);
+		return false;
 	}
 
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedFromCdn, Culture);
+	return true;
+}
+
+void UTolgeeCdnFetcherSubsystem::FetchFromCdn(const FTolgeeCdnCacheEntry& File)
+{
+	const FHttpRequestRef HttpRequest = CreateCdnRequest(File.Url, File.Url);
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedFromCdn, File, FetchGeneration);
 	HttpRequest->ProcessRequest();
 
 	NumRequestsSent++;
 }
 
-void UTolgeeCdnFetcherSubsystem::OnFetchedFromCdn(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString InCutlure)
+FHttpRequestRef UTolgeeCdnFetcherSubsystem::CreateCdnRequest(const FString& FileUrl, const FString& DownloadUrl) const
 {
-	if (bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	const FTolgeeCdnCacheEntry* CacheEntry = CacheEntries.Find(FileUrl);
+
+	const FHttpRequestRef HttpRequest = TolgeeUtils::CreateCdnRequest(DownloadUrl);
+
+	if (CacheEntry && !CacheEntry->LastModified.IsEmpty())
+	{
+		HttpRequest->SetHeader(TEXT("If-Modified-Since"), CacheEntry->LastModified);
+	}
+	if (CacheEntry && !CacheEntry->ETag.IsEmpty())
 	{
-		UE_LOG(LogTolgee, Display, TEXT("Fetch successfully for %s to %s."), *InCutlure, *Request->GetURL());
+		HttpRequest->SetHeader(TEXT("If-None-Match"), CacheEntry->ETag);
+	}
 
-		TArray<FTolgeeTranslationData> Translations = ExtractTranslationsFromPO(Response->GetContentAsString());
-		CachedTranslations.Emplace(InCutlure, Translations);
+	return HttpRequest;
+}
 
-		const FString LastModified = Response->GetHeader(TEXT("Last-Modified"));
-		if (!LastModified.IsEmpty())
+void UTolgeeCdnFetcherSubsystem::FetchFromMirrors(const FTolgeeCdnCacheEntry& File)
+{
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+
+	FTolgeeMirrorFetch& MirrorFetch = MirrorFetches.Add(File.Url);
+	MirrorFetch.File = File;
+	MirrorFetch.Mirrors = LatencyStats.SortByLatency(Settings->CdnAddresses);
+
+	UE_LOG(LogTolgee, Display, TEXT("Fetching localization data for culture: %s from CDN mirrors, fastest known mirror: %s"), *File.Culture, *MirrorFetch.Mirrors[0]);
+	SendToNextMirror(File.Url);
+
+	NumRequestsSent++;
+}
+
+void UTolgeeCdnFetcherSubsystem::SendToNextMirror(const FString& FileUrl)
+{
+	FTolgeeMirrorFetch* MirrorFetch = MirrorFetches.Find(FileUrl);
+	if (!MirrorFetch || MirrorFetch->NextMirror >= MirrorFetch->Mirrors.Num())
+	{
+		return;
+	}
+
+	const FString& Mirror = MirrorFetch->Mirrors[MirrorFetch->NextMirror++];
+	const FString DownloadUrl = TolgeeCdnCache::GetFileUrl(Mirror, MirrorFetch->File.Culture);
+
+	const FHttpRequestRef HttpRequest = CreateCdnRequest(FileUrl, DownloadUrl);
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedFromMirror, FileUrl, Mirror);
+	HttpRequest->ProcessRequest();
+	MirrorFetch->Requests.Add(HttpRequest);
+
+	// NOTE: If the mirror is slower than it usually is, the same file is requested from the next mirror as well and the first response wins.
+	if (MirrorFetch->NextMirror < MirrorFetch->Mirrors.Num() && ActiveGameInstance.IsValid())
+	{
+		const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+		const double HedgeDelay = LatencyStats.GetPercentile(Mirror, Settings->HedgeLatencyPercentile).Get(Settings->DefaultHedgeDelay);
+
+		const FTimerDelegate Delegate = FTimerDelegate::CreateUObject(this, &ThisClass::SendToNextMirror, FileUrl);
+		ActiveGameInstance->GetTimerManager().SetTimer(MirrorFetch->HedgeTimer, Delegate, static_cast<float>(FMath::Max(HedgeDelay, 0.01)), false);
+	}
+}
+
+void UTolgeeCdnFetcherSubsystem::OnFetchedFromMirror(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString FileUrl, FString Mirror)
+{
+	FTolgeeMirrorFetch* MirrorFetch = MirrorFetches.Find(FileUrl);
+	if (!MirrorFetch || !MirrorFetch->Requests.Contains(Request))
+	{
+		// NOTE: The fetch was already answered by another mirror and this request got cancelled.
+		return;
+	}
+
+	MirrorFetch->Requests.Remove(Request);
+
+	const bool bAnswered = bWasSuccessful && Response.IsValid() && (EHttpResponseCodes::IsOk(Response->GetResponseCode()) || Response->GetResponseCode() == EHttpResponseCodes::NotModified);
+	if (!bAnswered)
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Mirror %s failed to answer for %s."), *Mirror, *MirrorFetch->File.Culture);
+		LatencyStats.AddSample(Mirror, FailedMirrorLatency);
+
+		if (MirrorFetch->NextMirror < MirrorFetch->Mirrors.Num())
+		{
+			SendToNextMirror(FileUrl);
+			return;
+		}
+		if (!MirrorFetch->Requests.IsEmpty())
 		{
-			LastModifiedDates.Emplace(Request->GetURL(), LastModified);
+			return;
 		}
 	}
-	else if (Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotModified)
+	else
+	{
+		LatencyStats.AddSample(Mirror, Request->GetElapsedTime());
+	}
+
+	FTolgeeMirrorFetch CompletedFetch = MirrorFetches.FindAndRemoveChecked(FileUrl);
+	CancelMirrorFetch(CompletedFetch);
+
+	ProcessCdnResponse(CompletedFetch.File, Response, bAnswered);
+}
+
+void UTolgeeCdnFetcherSubsystem::CancelMirrorFetch(FTolgeeMirrorFetch& MirrorFetch)
+{
+	if (ActiveGameInstance.IsValid())
+	{
+		ActiveGameInstance->GetTimerManager().ClearTimer(MirrorFetch.HedgeTimer);
+	}
+
+	for (const FHttpRequestPtr& Request : MirrorFetch.Requests)
+	{
+		Request->CancelRequest();
+	}
+}
+
+void UTolgeeCdnFetcherSubsystem::OnFetchedFromCdn(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FTolgeeCdnCacheEntry File, int32 Generation)
+{
+	// NOTE: The counters were reset since the request was sent, completing it would throw them out of sync.
+	if (Generation != FetchGeneration)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding response for %s requested for a previous session."), *File.Culture);
+		return;
+	}
+
+	ProcessCdnResponse(File, Response, bWasSuccessful);
+}
+
+void UTolgeeCdnFetcherSubsystem::ProcessCdnResponse(const FTolgeeCdnCacheEntry& File, FHttpResponsePtr Response, bool bWasSuccessful)
+{
+	if (bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		UE_LOG(LogTolgee, Display, TEXT("Fetch successfully for %s to %s."), *File.Culture, *Response->GetURL());
+
+		FTolgeeCdnCacheEntry CacheEntry = File;
+		CacheEntry.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+		CacheEntry.ETag = Response->GetHeader(TEXT("ETag"));
+
+		// NOTE: Decompression and parsing happen on the task graph so multiple cultures are processed in parallel, the result is merged back on the game thread.
+		AsyncTask(
+			ENamedThreads::AnyBackgroundThreadNormalTask,
+			[WeakThis = TWeakObjectPtr<ThisClass>(this), Response, CacheEntry, Generation = FetchGeneration]() mutable
+			{
+				// NOTE: Translations stay unset when the body can't be used, the request then counts as failed and the previous data is kept.
+				TOptional<FTolgeeCultureIndexRef> Translations;
+
+				TArray<uint8> DecompressedContent;
+				TConstArrayView<uint8> Content;
+				FTolgeeCultureIndexBuilder Builder;
+				if (!TolgeeUtils::DecodeContent(Response->GetContent(), DecompressedContent, Content))
+				{
+					UE_LOG(LogTolgee, Error, TEXT("Failed to decompress the response for %s from %s."), *CacheEntry.Culture, *CacheEntry.Url);
+				}
+				else if (!TolgeePoParser::ParseIntoIndex(Content, Builder))
+				{
+					UE_LOG(LogTolgee, Error, TEXT("Failed to parse the response for %s from %s."), *CacheEntry.Culture, *CacheEntry.Url);
+				}
+				else
+				{
+					Translations = Builder.Build();
+					CacheEntry.ContentHash = TolgeeCdnCache::HashContent(Content);
+					CacheEntry.ContentSize = Content.Num();
+					TolgeeCdnCache::Save(CacheEntry, *Translations.GetValue());
+				}
+
+				AsyncTask(
+					ENamedThreads::GameThread,
+					[WeakThis, CacheEntry, Generation, Translations]()
+					{
+						if (WeakThis.IsValid())
+						{
+							WeakThis->OnTranslationsParsed(CacheEntry, Translations, Generation);
+						}
+					}
+				);
+			}
+		);
+		return;
+	}
+
+	if (Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotModified)
 	{
-		UE_LOG(LogTolgee, Display, TEXT("No new data for %s to %s."), *InCutlure, *Request->GetURL());
+		UE_LOG(LogTolgee, Display, TEXT("No new data for %s to %s."), *File.Culture, *File.Url);
 	}
 	else
 	{
-		UE_LOG(LogTolgee, Error, TEXT("Request for %s to %s failed."), *InCutlure, *Request->GetURL());
+		UE_LOG(LogTolgee, Error, TEXT("Request for %s to %s failed."), *File.Culture, *File.Url);
+		bHasFailedRequests = true;
+	}
+
+	OnRequestCompleted();
+}
+
+void UTolgeeCdnFetcherSubsystem::OnTranslationsParsed(const FTolgeeCdnCacheEntry& CacheEntry, const TOptional<FTolgeeCultureIndexRef>& Translations, int32 Generation)
+{
+	if (Generation != FetchGeneration)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding translations for %s parsed for a previous fetch."), *CacheEntry.Culture);
+		return;
 	}
 
+	if (Translations.IsSet())
+	{
+		CacheEntries.Emplace(CacheEntry.Url, CacheEntry);
+		MergeTranslations(CacheEntry, Translations.GetValue());
+		bHasPendingChanges = true;
+
+		// NOTE: The culture the player is using is injected as soon as it's ready, background cultures are published once all requests complete.
+		if (IsActiveCulture(CacheEntry.Culture))
+		{
+			UE_LOG(LogTolgee, Display, TEXT("Injecting active culture %s."), *CacheEntry.Culture);
+			PublishTranslations(CachedTranslations);
+			QueueRefresh();
+			UnpublishedCultures.Empty();
+		}
+		else
+		{
+			UnpublishedCultures.Add(CacheEntry.Culture);
+		}
+	}
+	else
+	{
+		bHasFailedRequests = true;
+	}
+
+	OnRequestCompleted();
+}
+
+void UTolgeeCdnFetcherSubsystem::MergeTranslations(const FTolgeeCdnCacheEntry& File, const FTolgeeCultureIndexRef& Translations)
+{
+	check(IsInGameThread());
+
+	FTolgeeLayeredCultureIndex& LayeredTranslations = LayeredCultures.FindOrAdd(File.Culture);
+	LayeredTranslations.SetLayer(File.Layer, Translations);
+
+	CachedTranslations.Emplace(File.Culture, LayeredTranslations.GetMerged());
+}
+
+void UTolgeeCdnFetcherSubsystem::OnRequestCompleted()
+{
 	NumRequestsCompleted++;
 
+	if (NumRequestsCompleted != NumRequestsSent)
+	{
+		return;
+	}
+
+	// NOTE: Only mirrors are ordered by latency, other setups don't record any samples.
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	if (Settings->bCdnAddressesAreMirrors)
+	{
+		LatencyStats.SaveAsync();
+	}
+
+	if (!UnpublishedCultures.IsEmpty())
+	{
+		// NOTE: Background cultures are not injected until the player switches to them, which reloads the resources anyway.
+		// The player might have switched while the requests were in flight, in which case a refresh is still needed.
+		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Publishing translation data for background cultures."));
+		PublishTranslations(CachedTranslations);
+		if (Algo::AnyOf(UnpublishedCultures, &ThisClass::IsActiveCulture))
+		{
+			QueueRefresh();
+		}
+		UnpublishedCultures.Empty();
+	}
+	else if (bHasPendingChanges)
+	{
+		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Translation data was already injected."));
+	}
+	else
+	{
+		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Cached translation data is up to date."));
+	}
+
+	// NOTE: Poll again soon while the data keeps changing, back off while it's stable or the CDN is failing.
+	if (bHasPendingChanges && !bHasFailedRequests)
+	{
+		CurrentPollingInterval = Settings->PollingInterval;
+	}
+	else
+	{
+		CurrentPollingInterval = FMath::Min(CurrentPollingInterval * Settings->PollingBackoffMultiplier, FMath::Max(Settings->MaxPollingInterval, Settings->PollingInterval));
+	}
+	bHasPendingChanges = false;
+	bHasFailedRequests = false;
+
+	SchedulePoll();
+	PrefetchNextCulture();
+}
+
+void UTolgeeCdnFetcherSubsystem::PrefetchNextCulture()
+{
+	// NOTE: One culture at a time and only while nothing else is in flight, so the prefetch never competes with the active cultures or a poll.
+	if (bPollingPaused || NumRequestsCompleted != NumRequestsSent)
+	{
+		return;
+	}
+
+	while (!PrefetchQueue.IsEmpty())
+	{
+		const FString Culture = PrefetchQueue[0];
+		PrefetchQueue.RemoveAt(0);
+
+		// The player might have switched to it in the meantime.
+		if (!RequestedCultures.Contains(Culture))
+		{
+			UE_LOG(LogTolgee, Verbose, TEXT("Prefetching culture %s in the background, %d left."), *Culture, PrefetchQueue.Num());
+			LoadCultures({Culture});
+			return;
+		}
+	}
+}
+
+void UTolgeeCdnFetcherSubsystem::SchedulePoll()
+{
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	if (!Settings->bEnablePolling || bPollingPaused || !ActiveGameInstance.IsValid())
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = ActiveGameInstance->GetTimerManager();
+	if (TimerManager.IsTimerActive(PollingTimer))
+	{
+		return;
+	}
+
+	const float Delay = CurrentPollingInterval * (1.0f + FMath::FRandRange(-Settings->PollingJitter, Settings->PollingJitter));
+	UE_LOG(LogTolgee, Verbose, TEXT("Next CDN poll in %.0f seconds."), Delay);
+
+	const FTimerDelegate Delegate = FTimerDelegate::CreateUObject(this, &ThisClass::OnPollTick);
+	TimerManager.SetTimer(PollingTimer, Delegate, Delay, false);
+}
+
+void UTolgeeCdnFetcherSubsystem::OnPollTick()
+{
+	// NOTE: If requests are still in flight, the poll is rescheduled once they complete.
+	if (NumRequestsCompleted != NumRequestsSent)
+	{
+		return;
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("Polling the CDN for new localization data."));
+	FetchCdnFiles(TolgeeCdnCache::GetFiles(RequestedCultures.Array()));
+}
+
+void UTolgeeCdnFetcherSubsystem::OnApplicationDeactivated()
+{
+	bPollingPaused = true;
+
+	if (ActiveGameInstance.IsValid())
+	{
+		ActiveGameInstance->GetTimerManager().ClearTimer(PollingTimer);
+	}
+}
+
+void UTolgeeCdnFetcherSubsystem::OnApplicationReactivated()
+{
+	bPollingPaused = false;
+
 	if (NumRequestsCompleted == NumRequestsSent)
 	{
-		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Refreshing translation data."));
-		RefreshTranslationDataAsync();
+		SchedulePoll();
+		PrefetchNextCulture();
 	}
 }
 
 void UTolgeeCdnFetcherSubsystem::ResetData()
 {
+	check(IsInGameThread());
+
+	if (ActiveGameInstance.IsValid())
+	{
+		ActiveGameInstance->GetTimerManager().ClearTimer(PollingTimer);
+	}
+
+	for (TPair<FString, FTolgeeMirrorFetch>& MirrorFetch : MirrorFetches)
+	{
+		CancelMirrorFetch(MirrorFetch.Value);
+	}
+	MirrorFetches.Empty();
+
 	NumRequestsSent = 0;
 	NumRequestsCompleted = 0;
+	FetchGeneration++;
+	bHasPendingChanges = false;
+	UnpublishedCultures.Empty();
+	bHasFailedRequests = false;
+	RequestedCultures.Empty();
+	PrefetchQueue.Empty();
 
+	LayeredCultures.Empty();
 	CachedTranslations.Empty();
+	PublishTranslations(CachedTranslations);
 }
\ No newline at end of file
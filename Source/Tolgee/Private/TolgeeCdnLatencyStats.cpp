@@ -0,0 +1,142 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeCdnLatencyStats.h"
+
+#include <Async/Async.h>
+#include <Dom/JsonObject.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Misc/ScopeLock.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <Serialization/JsonWriter.h>
+
+#include "TolgeeLog.h"
+
+namespace
+{
+	/**
+	 * Number of samples kept per address, old samples are dropped so the statistics follow network changes.
+	 */
+	constexpr int32 MaxSamplesPerAddress = 32;
+
+	/**
+	 * Identifier of the latest save requested, older saves still queued are dropped.
+	 */
+	TAtomic<uint32> LatestSaveId = 0;
+	/**
+	 * Serializes the writes of the statistics file.
+	 */
+	FCriticalSection SaveCriticalSection;
+} // namespace
+
+void FTolgeeCdnLatencyStats::Load()
+{
+	Samples.Empty();
+
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *GetFilePath()))
+	{
+		return;
+	}
+
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FileContent);
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to read CDN latency statistics from %s."), *GetFilePath());
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Address : JsonObject->Values)
+	{
+		TArray<double>& AddressSamples = Samples.Add(Address.Key);
+		for (const TSharedPtr<FJsonValue>& Sample : Address.Value->AsArray())
+		{
+			AddressSamples.Add(Sample->AsNumber());
+		}
+	}
+}
+
+void FTolgeeCdnLatencyStats::SaveAsync() const
+{
+	const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, TArray<double>>& Address : Samples)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonSamples;
+		for (const double Sample : Address.Value)
+		{
+			JsonSamples.Add(MakeShared<FJsonValueNumber>(Sample));
+		}
+		JsonObject->SetArrayField(Address.Key, JsonSamples);
+	}
+
+	FString FileContent;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&FileContent);
+	FJsonSerializer::Serialize(JsonObject, JsonWriter);
+
+	AsyncTask(
+		ENamedThreads::AnyBackgroundThreadNormalTask,
+		[FileContent = MoveTemp(FileContent), SaveId = ++LatestSaveId]()
+		{
+			FScopeLock Lock(&SaveCriticalSection);
+			if (SaveId != LatestSaveId)
+			{
+				return;
+			}
+
+			if (!FFileHelper::SaveStringToFile(FileContent, *GetFilePath()))
+			{
+				UE_LOG(LogTolgee, Warning, TEXT("Failed to write CDN latency statistics to %s."), *GetFilePath());
+			}
+		}
+	);
+}
+
+void FTolgeeCdnLatencyStats::AddSample(const FString& Address, double Seconds)
+{
+	TArray<double>& AddressSamples = Samples.FindOrAdd(Address);
+	if (AddressSamples.Num() >= MaxSamplesPerAddress)
+	{
+		AddressSamples.RemoveAt(0, AddressSamples.Num() - MaxSamplesPerAddress + 1);
+	}
+	AddressSamples.Add(Seconds);
+}
+
+TOptional<double> FTolgeeCdnLatencyStats::GetPercentile(const FString& Address, float Percentile) const
+{
+	const TArray<double>* AddressSamples = Samples.Find(Address);
+	if (!AddressSamples || AddressSamples->IsEmpty())
+	{
+		return {};
+	}
+
+	TArray<double> SortedSamples = *AddressSamples;
+	SortedSamples.Sort();
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt32(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+	return SortedSamples[Index];
+}
+
+TArray<FString> FTolgeeCdnLatencyStats::SortByLatency(const TArray<FString>& Addresses) const
+{
+	TArray<FString> SortedAddresses = Addresses;
+	SortedAddresses.StableSort(
+		[this](const FString& A, const FString& B)
+		{
+			const TOptional<double> MedianA = GetPercentile(A, 0.5f);
+			const TOptional<double> MedianB = GetPercentile(B, 0.5f);
+			if (MedianA.IsSet() != MedianB.IsSet())
+			{
+				return MedianA.IsSet();
+			}
+			return MedianA.IsSet() && MedianA.GetValue() < MedianB.GetValue();
+		}
+	);
+	return SortedAddresses;
+}
+
+FString FTolgeeCdnLatencyStats::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Tolgee") / TEXT("CdnLatency.json");
+}
@@ -0,0 +1,241 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeCultureIndex.h"
+
+#include <Algo/BinarySearch.h>
+#include <Internationalization/TextLocalizationResource.h>
+
+FTolgeeCultureIndex::FTolgeeCultureIndex()
+{
+	LookupBuckets.SetNum(NumLookupBuckets);
+}
+
+FTolgeeCultureIndexRef FTolgeeCultureIndex::CreateFromStorage(const FTolgeeCultureIndexStorageRef& InStorage)
+{
+	const TSharedRef<FTolgeeCultureIndex, ESPMode::ThreadSafe> Index = MakeShared<FTolgeeCultureIndex, ESPMode::ThreadSafe>();
+	Index->Storage = InStorage;
+	Index->NumEntries = InStorage->NumEntries;
+
+	// NOTE: Only the chunks are allocated, they point to consecutive ranges of the storage entries.
+	Index->Chunks.Reserve(FMath::DivideAndRoundUp(InStorage->NumEntries, ChunkSize));
+	for (int32 ChunkStart = 0; ChunkStart < InStorage->NumEntries; ChunkStart += ChunkSize)
+	{
+		const TSharedRef<FChunk, ESPMode::ThreadSafe> Chunk = MakeShared<FChunk, ESPMode::ThreadSafe>();
+		Chunk->Storage = InStorage;
+		Chunk->StorageStart = ChunkStart;
+		Chunk->StorageNum = FMath::Min(ChunkSize, InStorage->NumEntries - ChunkStart);
+		Index->Chunks.Add(Chunk);
+	}
+
+	return Index;
+}
+
+int32 FTolgeeCultureIndex::Find(const FTextId& Id) const
+{
+	const uint32 IdHash = GetTypeHash(Id);
+	const int32 BucketIndex = GetLookupBucketIndex(IdHash);
+
+	const TSharedPtr<FLookupBucket, ESPMode::ThreadSafe>& Bucket = LookupBuckets[BucketIndex];
+	if (Bucket.IsValid())
+	{
+		const int32* Position = Bucket->FindByHash(IdHash, Id);
+		return Position ? *Position : INDEX_NONE;
+	}
+
+	return Storage.IsValid() ? FindInStorage(Id, IdHash, BucketIndex) : INDEX_NONE;
+}
+
+int32 FTolgeeCultureIndex::FindInStorage(const FTextId& Id, uint32 IdHash, int32 BucketIndex) const
+{
+	const uint32 BucketStart = Storage->LookupBucketStarts[BucketIndex];
+	const TConstArrayView<FTolgeeCultureIndexStorage::FLookupEntry> BucketEntries(Storage->Lookup + BucketStart, Storage->LookupBucketStarts[BucketIndex + 1] - BucketStart);
+
+	// NOTE: Only the entries sharing the hash are compared, which builds their text keys.
+	for (int32 LookupIndex = Algo::LowerBoundBy(BucketEntries, IdHash, &FTolgeeCultureIndexStorage::FLookupEntry::IdHash); LookupIndex < BucketEntries.Num() && BucketEntries[LookupIndex].IdHash == IdHash; ++LookupIndex)
+	{
+		const int32 Position = BucketEntries[LookupIndex].Position;
+		if (GetId(Position) == Id)
+		{
+			return Position;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 FTolgeeCultureIndex::GetLookupBucketIndex(uint32 IdHash)
+{
+	// NOTE: The maps inside the buckets index by the low bits of the same hash, so the bucket is picked from the high bits of a scrambled one.
+	static_assert(NumLookupBuckets == 64, "The shift below assumes 64 lookup buckets.");
+	return static_cast<int32>((IdHash * 0x9E3779B9u) >> 26);
+}
+
+FTolgeeCultureIndexBuilder::FTolgeeCultureIndexBuilder() :
+	Index(MakeShared<FTolgeeCultureIndex, ESPMode::ThreadSafe>())
+{
+}
+
+FTolgeeCultureIndexBuilder::FTolgeeCultureIndexBuilder(const FTolgeeCultureIndexRef& Base) :
+	Index(MakeShared<FTolgeeCultureIndex, ESPMode::ThreadSafe>(*Base))
+{
+}
+
+void FTolgeeCultureIndexBuilder::Reserve(int32 Num)
+{
+	ReservedNum = FMath::Max(ReservedNum, Num);
+	Index->Chunks.Reserve(FMath::DivideAndRoundUp(Num, FTolgeeCultureIndex::ChunkSize));
+}
+
+void FTolgeeCultureIndexBuilder::Add(const FString& Namespace, const FString& Key, const FString& SourceString, FString Translation)
+{
+	const FTextId Id = FTextId(FTextKey(Namespace), FTextKey(Key));
+	Add(Id, FTextLocalizationResource::HashString(SourceString), MoveTemp(Translation));
+}
+
+void FTolgeeCultureIndexBuilder::Append(const FTolgeeCultureIndex& Other)
+{
+	Reserve(Num() + Other.Num());
+
+	for (int32 EntryIndex = 0; EntryIndex < Other.Num(); ++EntryIndex)
+	{
+		Add(Other.GetId(EntryIndex), Other.GetSourceStringHash(EntryIndex), FString(Other.GetTranslation(EntryIndex)));
+	}
+}
+
+int32 FTolgeeCultureIndexBuilder::Num() const
+{
+	return Index->Num();
+}
+
+FTolgeeCultureIndexRef FTolgeeCultureIndexBuilder::Build()
+{
+	FTolgeeCultureIndexRef Result = Index;
+	Index = MakeShared<FTolgeeCultureIndex, ESPMode::ThreadSafe>();
+	ReservedNum = 0;
+	return Result;
+}
+
+void FTolgeeCultureIndexBuilder::Add(const FTextId& Id, uint32 SourceStringHash, FString Translation)
+{
+	const int32 ExistingPosition = Index->Find(Id);
+	if (ExistingPosition != INDEX_NONE)
+	{
+		FTolgeeCultureIndex::FChunk& Chunk = GetMutableChunk(ExistingPosition >> FTolgeeCultureIndex::ChunkShift);
+		Chunk.SourceStringHashes[ExistingPosition & FTolgeeCultureIndex::ChunkMask] = SourceStringHash;
+		Chunk.Translations[ExistingPosition & FTolgeeCultureIndex::ChunkMask] = MoveTemp(Translation);
+		return;
+	}
+
+	const int32 Position = Index->NumEntries;
+	const int32 ChunkIndex = Position >> FTolgeeCultureIndex::ChunkShift;
+	if (ChunkIndex == Index->Chunks.Num())
+	{
+		const int32 ChunkCapacity = FMath::Clamp(ReservedNum - Position, 0, FTolgeeCultureIndex::ChunkSize);
+
+		TSharedRef<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe> NewChunk = MakeShared<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe>();
+		NewChunk->Ids.Reserve(ChunkCapacity);
+		NewChunk->SourceStringHashes.Reserve(ChunkCapacity);
+		NewChunk->Translations.Reserve(ChunkCapacity);
+		Index->Chunks.Add(NewChunk);
+	}
+
+	FTolgeeCultureIndex::FChunk& Chunk = GetMutableChunk(ChunkIndex);
+	Chunk.Ids.Add(Id);
+	Chunk.SourceStringHashes.Add(SourceStringHash);
+	Chunk.Translations.Add(MoveTemp(Translation));
+
+	GetMutableLookupBucket(Id).Add(Id, Position);
+	Index->NumEntries++;
+}
+
+void FTolgeeCultureIndexBuilder::Remove(const FTextId& Id)
+{
+	int32 Position = INDEX_NONE;
+	if (Index->Find(Id) == INDEX_NONE || !GetMutableLookupBucket(Id).RemoveAndCopyValue(Id, Position))
+	{
+		return;
+	}
+
+	// NOTE: The last entry is moved into the freed slot, so its position has to be updated.
+	const int32 LastPosition = Index->NumEntries - 1;
+	FTolgeeCultureIndex::FChunk& LastChunk = GetMutableChunk(LastPosition >> FTolgeeCultureIndex::ChunkShift);
+	if (Position != LastPosition)
+	{
+		FTolgeeCultureIndex::FChunk& Chunk = GetMutableChunk(Position >> FTolgeeCultureIndex::ChunkShift);
+		const int32 LocalPosition = Position & FTolgeeCultureIndex::ChunkMask;
+
+		Chunk.Ids[LocalPosition] = LastChunk.Ids.Last();
+		Chunk.SourceStringHashes[LocalPosition] = LastChunk.SourceStringHashes.Last();
+		Chunk.Translations[LocalPosition] = MoveTemp(LastChunk.Translations.Last());
+
+		GetMutableLookupBucket(Chunk.Ids[LocalPosition]).Add(Chunk.Ids[LocalPosition], Position);
+	}
+
+	LastChunk.Ids.Pop();
+	LastChunk.SourceStringHashes.Pop();
+	LastChunk.Translations.Pop();
+	if (LastChunk.Ids.IsEmpty())
+	{
+		Index->Chunks.Pop();
+	}
+
+	Index->NumEntries--;
+}
+
+FTolgeeCultureIndex::FChunk& FTolgeeCultureIndexBuilder::GetMutableChunk(int32 ChunkIndex)
+{
+	TSharedRef<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe>& Chunk = Index->Chunks[ChunkIndex];
+	if (Chunk->Storage.IsValid())
+	{
+		// NOTE: Entries read from a storage are copied into the arrays once their chunk is modified, the storage itself is never written.
+		const TSharedRef<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe> CopiedChunk = MakeShared<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe>();
+		CopiedChunk->Ids.Reserve(Chunk->StorageNum);
+		CopiedChunk->SourceStringHashes.Reserve(Chunk->StorageNum);
+		CopiedChunk->Translations.Reserve(Chunk->StorageNum);
+
+		const int32 ChunkStart = ChunkIndex << FTolgeeCultureIndex::ChunkShift;
+		for (int32 EntryIndex = ChunkStart; EntryIndex < ChunkStart + Chunk->StorageNum; ++EntryIndex)
+		{
+			CopiedChunk->Ids.Add(Index->GetId(EntryIndex));
+			CopiedChunk->SourceStringHashes.Add(Index->GetSourceStringHash(EntryIndex));
+			CopiedChunk->Translations.Add(FString(Index->GetTranslation(EntryIndex)));
+		}
+
+		Chunk = CopiedChunk;
+	}
+	else if (!Chunk.IsUnique())
+	{
+		Chunk = MakeShared<FTolgeeCultureIndex::FChunk, ESPMode::ThreadSafe>(*Chunk);
+	}
+
+	return *Chunk;
+}
+
+FTolgeeCultureIndex::FLookupBucket& FTolgeeCultureIndexBuilder::GetMutableLookupBucket(const FTextId& Id)
+{
+	const int32 BucketIndex = FTolgeeCultureIndex::GetLookupBucketIndex(GetTypeHash(Id));
+	TSharedPtr<FTolgeeCultureIndex::FLookupBucket, ESPMode::ThreadSafe>& Bucket = Index->LookupBuckets[BucketIndex];
+	if (!Bucket.IsValid())
+	{
+		Bucket = MakeShared<FTolgeeCultureIndex::FLookupBucket, ESPMode::ThreadSafe>();
+
+		// NOTE: Entries of a bucket that was never modified are still at the position the storage lookup lists.
+		if (const FTolgeeCultureIndexStorage* Storage = Index->Storage.Get())
+		{
+			const uint32 BucketStart = Storage->LookupBucketStarts[BucketIndex];
+			const uint32 BucketEnd = Storage->LookupBucketStarts[BucketIndex + 1];
+			Bucket->Reserve(BucketEnd - BucketStart);
+			for (uint32 LookupIndex = BucketStart; LookupIndex < BucketEnd; ++LookupIndex)
+			{
+				const FTolgeeCultureIndexStorage::FLookupEntry& LookupEntry = Storage->Lookup[LookupIndex];
+				Bucket->AddByHash(LookupEntry.IdHash, Index->GetId(LookupEntry.Position), LookupEntry.Position);
+			}
+		}
+	}
+	else if (!Bucket.IsUnique())
+	{
+		Bucket = MakeShared<FTolgeeCultureIndex::FLookupBucket, ESPMode::ThreadSafe>(*Bucket);
+	}
+
+	return *Bucket;
+}
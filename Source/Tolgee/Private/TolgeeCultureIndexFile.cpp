@@ -0,0 +1,296 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeCultureIndexFile.h"
+
+#include <Async/MappedFileHandle.h>
+#include <HAL/FileManager.h>
+#include <HAL/PlatformFileManager.h>
+#include <Misc/EngineVersionComparison.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Misc/SecureHash.h>
+
+#include "TolgeeLog.h"
+
+namespace
+{
+	constexpr uint32 FileMagic = 0x49474C54; // "TLGI"
+	constexpr uint32 FileVersion = 2;
+	/**
+	 * The lookup is keyed by text key hashes, which only the engine version that wrote the file is guaranteed to reproduce.
+	 */
+	constexpr uint32 FileEngineVersion = ENGINE_MAJOR_VERSION * 100 + ENGINE_MINOR_VERSION;
+
+	struct FFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 CharSize;
+		uint32 EngineVersion;
+		uint32 NumEntries;
+		uint32 NumPoolChars;
+		uint8 ContentHash[20];
+	};
+
+	// NOTE: Every section keeps 4 byte alignment, so the loaded index reads the entries straight from the mapped file.
+	static_assert(sizeof(FFileHeader) % 4 == 0 && sizeof(FTolgeeCultureIndexStorage::FEntry) % 4 == 0 && sizeof(FTolgeeCultureIndexStorage::FLookupEntry) % 4 == 0, "File sections have to stay aligned.");
+
+	constexpr uint32 NumLookupBucketStarts = FTolgeeCultureIndex::NumLookupBuckets + 1;
+
+	/**
+	 * Keeps the file mapped (or loaded) for as long as an index reads from it.
+	 */
+	class FFileStorage : public FTolgeeCultureIndexStorage
+	{
+	public:
+		TUniquePtr<IMappedFileHandle> MappedFile;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TArray<uint8> LoadedContent;
+	};
+
+	/**
+	 * Appends a null terminated string to the pool and returns its offset.
+	 */
+	uint32 AddToPool(TArray<TCHAR>& Pool, FStringView String)
+	{
+		const uint32 Offset = Pool.Num();
+		Pool.Append(String.GetData(), String.Len());
+		Pool.Add(TEXT('\0'));
+		return Offset;
+	}
+
+	/**
+	 * Checks that the string is inside the pool and null terminated, so a corrupted file can't read out of bounds.
+	 */
+	bool IsValidPoolString(const TCHAR* Pool, uint32 NumPoolChars, uint32 Offset, uint32 Length)
+	{
+		return Offset < NumPoolChars && Length < NumPoolChars - Offset && Pool[Offset + Length] == TEXT('\0');
+	}
+
+	/**
+	 * Checks that every string and lookup position of the file stays in bounds.
+	 */
+	bool IsValidStorage(const FTolgeeCultureIndexStorage& Storage, uint32 NumPoolChars)
+	{
+		for (int32 EntryIndex = 0; EntryIndex < Storage.NumEntries; ++EntryIndex)
+		{
+			const FTolgeeCultureIndexStorage::FEntry& Entry = Storage.Entries[EntryIndex];
+			if (!IsValidPoolString(Storage.Pool, NumPoolChars, Entry.NamespaceOffset, Entry.NamespaceLength) || !IsValidPoolString(Storage.Pool, NumPoolChars, Entry.KeyOffset, Entry.KeyLength) || !IsValidPoolString(Storage.Pool, NumPoolChars, Entry.TranslationOffset, Entry.TranslationLength))
+			{
+				return false;
+			}
+		}
+
+		if (Storage.LookupBucketStarts[0] != 0 || Storage.LookupBucketStarts[NumLookupBucketStarts - 1] != static_cast<uint32>(Storage.NumEntries))
+		{
+			return false;
+		}
+		for (uint32 BucketIndex = 1; BucketIndex < NumLookupBucketStarts; ++BucketIndex)
+		{
+			if (Storage.LookupBucketStarts[BucketIndex] < Storage.LookupBucketStarts[BucketIndex - 1])
+			{
+				return false;
+			}
+		}
+
+		for (int32 LookupIndex = 0; LookupIndex < Storage.NumEntries; ++LookupIndex)
+		{
+			if (Storage.Lookup[LookupIndex].Position >= static_cast<uint32>(Storage.NumEntries))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FString TextKeyToString(const FTextKey& TextKey)
+	{
+#if UE_VERSION_NEWER_THAN(5, 5, 0)
+		return TextKey.ToString();
+#else
+		return TextKey.GetChars();
+#endif
+	}
+} // namespace
+
+bool TolgeeCultureIndexFile::Save(const FString& Path, const FTolgeeCultureIndex& Index, const FString& ContentHash)
+{
+	TArray<FTolgeeCultureIndexStorage::FEntry> Entries;
+	Entries.Reserve(Index.Num());
+
+	TArray<FTolgeeCultureIndexStorage::FLookupEntry> Lookup;
+	Lookup.Reserve(Index.Num());
+
+	TArray<TCHAR> Pool;
+	TMap<FTextKey, uint32> NamespaceOffsets;
+
+	for (int32 EntryIndex = 0; EntryIndex < Index.Num(); ++EntryIndex)
+	{
+		const FTextId Id = Index.GetId(EntryIndex);
+		const FString Namespace = TextKeyToString(Id.GetNamespace());
+		const FString Key = TextKeyToString(Id.GetKey());
+		const FStringView Translation = Index.GetTranslation(EntryIndex);
+
+		// NOTE: Most entries share a handful of namespaces, so they are stored only once.
+		uint32 NamespaceOffset = 0;
+		if (const uint32* ExistingOffset = NamespaceOffsets.Find(Id.GetNamespace()))
+		{
+			NamespaceOffset = *ExistingOffset;
+		}
+		else
+		{
+			NamespaceOffset = AddToPool(Pool, Namespace);
+			NamespaceOffsets.Add(Id.GetNamespace(), NamespaceOffset);
+		}
+
+		FTolgeeCultureIndexStorage::FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.NamespaceOffset = NamespaceOffset;
+		Entry.NamespaceLength = Namespace.Len();
+		Entry.KeyOffset = AddToPool(Pool, Key);
+		Entry.KeyLength = Key.Len();
+		Entry.TranslationOffset = AddToPool(Pool, Translation);
+		Entry.TranslationLength = Translation.Len();
+		Entry.SourceStringHash = Index.GetSourceStringHash(EntryIndex);
+
+		Lookup.Add({GetTypeHash(Id), static_cast<uint32>(EntryIndex)});
+	}
+
+	// NOTE: The lookup is written sorted by bucket and hash, so a loaded index searches it in place instead of building maps.
+	Lookup.Sort([](const FTolgeeCultureIndexStorage::FLookupEntry& A, const FTolgeeCultureIndexStorage::FLookupEntry& B)
+	{
+		const int32 BucketA = FTolgeeCultureIndex::GetLookupBucketIndex(A.IdHash);
+		const int32 BucketB = FTolgeeCultureIndex::GetLookupBucketIndex(B.IdHash);
+		return BucketA != BucketB ? BucketA < BucketB : A.IdHash < B.IdHash;
+	});
+
+	TArray<uint32> LookupBucketStarts;
+	LookupBucketStarts.SetNumZeroed(NumLookupBucketStarts);
+	for (const FTolgeeCultureIndexStorage::FLookupEntry& LookupEntry : Lookup)
+	{
+		LookupBucketStarts[FTolgeeCultureIndex::GetLookupBucketIndex(LookupEntry.IdHash) + 1]++;
+	}
+	for (uint32 BucketIndex = 1; BucketIndex < NumLookupBucketStarts; ++BucketIndex)
+	{
+		LookupBucketStarts[BucketIndex] += LookupBucketStarts[BucketIndex - 1];
+	}
+
+	FFileHeader Header = {};
+	Header.Magic = FileMagic;
+	Header.Version = FileVersion;
+	Header.CharSize = sizeof(TCHAR);
+	Header.EngineVersion = FileEngineVersion;
+	Header.NumEntries = Entries.Num();
+	Header.NumPoolChars = Pool.Num();
+	if (!ContentHash.IsEmpty())
+	{
+		FSHAHash Hash;
+		Hash.FromString(ContentHash);
+		FMemory::Memcpy(Header.ContentHash, Hash.Hash, sizeof(Header.ContentHash));
+	}
+
+	TArray<uint8> FileContent;
+	FileContent.Reserve(sizeof(FFileHeader) + Entries.Num() * sizeof(FTolgeeCultureIndexStorage::FEntry) + LookupBucketStarts.Num() * sizeof(uint32) + Lookup.Num() * sizeof(FTolgeeCultureIndexStorage::FLookupEntry) + Pool.Num() * sizeof(TCHAR));
+	FileContent.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FFileHeader));
+	FileContent.Append(reinterpret_cast<const uint8*>(Entries.GetData()), Entries.Num() * sizeof(FTolgeeCultureIndexStorage::FEntry));
+	FileContent.Append(reinterpret_cast<const uint8*>(LookupBucketStarts.GetData()), LookupBucketStarts.Num() * sizeof(uint32));
+	FileContent.Append(reinterpret_cast<const uint8*>(Lookup.GetData()), Lookup.Num() * sizeof(FTolgeeCultureIndexStorage::FLookupEntry));
+	FileContent.Append(reinterpret_cast<const uint8*>(Pool.GetData()), Pool.Num() * sizeof(TCHAR));
+
+	// NOTE: Indices loaded from the previous file keep reading it, so the new one replaces it by a move instead of being written in place.
+	const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(Path), *FPaths::GetBaseFilename(Path), TEXT(".tmp"));
+	if (!FFileHelper::SaveArrayToFile(FileContent, *TempPath))
+	{
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*Path, *TempPath, true, true, false, true))
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return false;
+	}
+
+	return true;
+}
+
+TOptional<FTolgeeCultureIndexRef> TolgeeCultureIndexFile::Load(const FString& Path, const FString& ExpectedContentHash)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const TSharedRef<FFileStorage, ESPMode::ThreadSafe> Storage = MakeShared<FFileStorage, ESPMode::ThreadSafe>();
+
+	// NOTE: Memory mapping avoids copying the file, platforms without support fall back to reading it into memory.
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	Storage->MappedFile.Reset(PlatformFile.OpenMapped(*Path));
+#else
+	IPlatformFile::FOpenMappedResult MappedFileResult = PlatformFile.OpenMappedEx(*Path);
+	Storage->MappedFile = MappedFileResult.HasValue() ? MappedFileResult.StealValue() : nullptr;
+#endif
+	Storage->MappedRegion.Reset(Storage->MappedFile ? Storage->MappedFile->MapRegion(0, Storage->MappedFile->GetFileSize()) : nullptr);
+
+	TConstArrayView<uint8> FileContent;
+	if (Storage->MappedRegion)
+	{
+		FileContent = TConstArrayView<uint8>(Storage->MappedRegion->GetMappedPtr(), Storage->MappedRegion->GetMappedSize());
+	}
+	else if (FFileHelper::LoadFileToArray(Storage->LoadedContent, *Path, FILEREAD_Silent))
+	{
+		FileContent = Storage->LoadedContent;
+	}
+	else
+	{
+		return {};
+	}
+
+	if (static_cast<uint64>(FileContent.Num()) < sizeof(FFileHeader))
+	{
+		return {};
+	}
+
+	FFileHeader Header;
+	FMemory::Memcpy(&Header, FileContent.GetData(), sizeof(FFileHeader));
+	if (Header.Magic != FileMagic || Header.Version != FileVersion || Header.CharSize != sizeof(TCHAR) || Header.EngineVersion != FileEngineVersion)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Ignoring cached translations %s written by an incompatible version or platform."), *Path);
+		return {};
+	}
+
+	const uint64 EntriesSize = static_cast<uint64>(Header.NumEntries) * sizeof(FTolgeeCultureIndexStorage::FEntry);
+	const uint64 LookupBucketStartsSize = NumLookupBucketStarts * sizeof(uint32);
+	const uint64 LookupSize = static_cast<uint64>(Header.NumEntries) * sizeof(FTolgeeCultureIndexStorage::FLookupEntry);
+	const uint64 ExpectedSize = sizeof(FFileHeader) + EntriesSize + LookupBucketStartsSize + LookupSize + static_cast<uint64>(Header.NumPoolChars) * sizeof(TCHAR);
+	if (Header.NumEntries > static_cast<uint32>(MAX_int32) || static_cast<uint64>(FileContent.Num()) != ExpectedSize)
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Cached translations %s are corrupted."), *Path);
+		return {};
+	}
+
+	if (!ExpectedContentHash.IsEmpty())
+	{
+		FSHAHash ContentHash;
+		FMemory::Memcpy(ContentHash.Hash, Header.ContentHash, sizeof(Header.ContentHash));
+		if (!ContentHash.ToString().Equals(ExpectedContentHash, ESearchCase::IgnoreCase))
+		{
+			UE_LOG(LogTolgee, Warning, TEXT("Cached translations %s don't match the cached content hash."), *Path);
+			return {};
+		}
+	}
+
+	const uint8* Section = FileContent.GetData() + sizeof(FFileHeader);
+	Storage->Entries = reinterpret_cast<const FTolgeeCultureIndexStorage::FEntry*>(Section);
+	Storage->NumEntries = static_cast<int32>(Header.NumEntries);
+	Section += EntriesSize;
+	Storage->LookupBucketStarts = reinterpret_cast<const uint32*>(Section);
+	Section += LookupBucketStartsSize;
+	Storage->Lookup = reinterpret_cast<const FTolgeeCultureIndexStorage::FLookupEntry*>(Section);
+	Section += LookupSize;
+	Storage->Pool = reinterpret_cast<const TCHAR*>(Section);
+
+	if (!IsValidStorage(*Storage, Header.NumPoolChars))
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Cached translations %s are corrupted."), *Path);
+		return {};
+	}
+
+	// NOTE: Nothing is copied, the index reads the entries and the lookup in place and builds text keys only for the entries it injects.
+	return FTolgeeCultureIndex::CreateFromStorage(Storage);
+}
@@ -0,0 +1,104 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeLayeredCultureIndex.h"
+
+FTolgeeLayeredCultureIndex::FTolgeeLayeredCultureIndex() :
+	Merged(FTolgeeCultureIndexBuilder().Build())
+{
+}
+
+void FTolgeeLayeredCultureIndex::SetLayer(int32 Layer, const FTolgeeCultureIndexRef& Translations)
+{
+	check(Layer >= 0);
+
+	if (Layer >= Layers.Num())
+	{
+		Layers.SetNum(Layer + 1);
+	}
+
+	const TOptional<FTolgeeCultureIndexRef> PreviousTranslations = Layers[Layer];
+	Layers[Layer] = Translations;
+
+	// NOTE: With a single layer there is nothing to merge.
+	const bool bHasOtherLayers = Layers.ContainsByPredicate([&Translations](const TOptional<FTolgeeCultureIndexRef>& Other) { return Other.IsSet() && Other.GetValue() != Translations; });
+	if (!bHasOtherLayers)
+	{
+		Merged = Translations;
+		return;
+	}
+
+	// NOTE: The merged index is shared with the published snapshots, so the patch goes to a new index that copies only the chunks holding changed entries.
+	// Other layers are never visited entry by entry.
+	FTolgeeCultureIndexBuilder Builder(Merged);
+
+	for (int32 EntryIndex = 0; EntryIndex < Translations->Num(); ++EntryIndex)
+	{
+		const FTextId Id = Translations->GetId(EntryIndex);
+		if (IsOverridden(Id, Layer))
+		{
+			continue;
+		}
+
+		if (PreviousTranslations.IsSet())
+		{
+			const int32 PreviousIndex = PreviousTranslations.GetValue()->Find(Id);
+			if (PreviousIndex != INDEX_NONE && PreviousTranslations.GetValue()->GetSourceStringHash(PreviousIndex) == Translations->GetSourceStringHash(EntryIndex) && PreviousTranslations.GetValue()->GetTranslation(PreviousIndex).Equals(Translations->GetTranslation(EntryIndex), ESearchCase::CaseSensitive))
+			{
+				continue;
+			}
+		}
+
+		Builder.Add(Id, Translations->GetSourceStringHash(EntryIndex), FString(Translations->GetTranslation(EntryIndex)));
+	}
+
+	if (PreviousTranslations.IsSet())
+	{
+		const FTolgeeCultureIndex& Previous = *PreviousTranslations.GetValue();
+		for (int32 EntryIndex = 0; EntryIndex < Previous.Num(); ++EntryIndex)
+		{
+			const FTextId Id = Previous.GetId(EntryIndex);
+			if (Translations->Find(Id) != INDEX_NONE || IsOverridden(Id, Layer))
+			{
+				continue;
+			}
+
+			// NOTE: The layer dropped this text, fall back to the closest earlier layer that still translates it.
+			bool bFoundFallback = false;
+			for (int32 FallbackLayer = Layer - 1; FallbackLayer >= 0 && !bFoundFallback; --FallbackLayer)
+			{
+				if (!Layers[FallbackLayer].IsSet())
+				{
+					continue;
+				}
+
+				const FTolgeeCultureIndex& Fallback = *Layers[FallbackLayer].GetValue();
+				const int32 FallbackIndex = Fallback.Find(Id);
+				if (FallbackIndex != INDEX_NONE)
+				{
+					Builder.Add(Id, Fallback.GetSourceStringHash(FallbackIndex), FString(Fallback.GetTranslation(FallbackIndex)));
+					bFoundFallback = true;
+				}
+			}
+
+			if (!bFoundFallback)
+			{
+				Builder.Remove(Id);
+			}
+		}
+	}
+
+	Merged = Builder.Build();
+}
+
+bool FTolgeeLayeredCultureIndex::IsOverridden(const FTextId& Id, int32 Layer) const
+{
+	for (int32 OverridingLayer = Layer + 1; OverridingLayer < Layers.Num(); ++OverridingLayer)
+	{
+		if (Layers[OverridingLayer].IsSet() && Layers[OverridingLayer].GetValue()->Find(Id) != INDEX_NONE)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -2,21 +2,20 @@
 
 #include "TolgeeLocalizationInjectorSubsystem.h"
 
-#include <Async/Async.h>
 #include <Engine/World.h>
+#include <Internationalization/Culture.h>
+#include <Internationalization/Internationalization.h>
 #include <Misc/EngineVersionComparison.h>
+#include <Internationalization/TextLocalizationManager.h>
 #include <Internationalization/TextLocalizationResource.h>
 
 #if WITH_EDITOR
 #include <Editor.h>
 #endif
 
-#if WITH_LOCALIZATION_MODULE
-#include <PortableObjectFormatDOM.h>
-#include <PortableObjectPipeline.h>
-#endif
-
 #include "TolgeeLog.h"
+#include "TolgeePoParser.h"
+#include "TolgeeRefreshScheduler.h"
 #include "TolgeeTextSource.h"
 
 void UTolgeeLocalizationInjectorSubsystem::OnGameInstanceStart(UGameInstance* GameInstance)
@@ -29,43 +28,72 @@ void UTolgeeLocalizationInjectorSubsystem::OnGameInstanceEnd(bool bIsSimulating)
 
 void UTolgeeLocalizationInjectorSubsystem::GetLocalizedResources(const ELocalizationLoadFlags InLoadFlags, TArrayView<const FString> InPrioritizedCultures, FTextLocalizationResource& InOutNativeResource, FTextLocalizationResource& InOutLocalizedResource) const
 {
-	TMap<FString, TArray<FTolgeeTranslationData>> DataToInject = GetDataToInject();
-	for (const TPair<FString, TArray<FTolgeeTranslationData>>& CachedTranslation : DataToInject)
+	const FTolgeeTranslationSnapshotPtr DataToInject = GetDataToInject();
+
+	FScopeLock Lock(&InjectionCriticalSection);
+	LastInjectedSnapshot = DataToInject;
+	LastInjectedCultures = TArray<FString>(InPrioritizedCultures.GetData(), InPrioritizedCultures.Num());
+	LiveSourceStringHashes.Reset();
+
+	if (!DataToInject)
+	{
+		return;
+	}
+
+	// NOTE: Cultures are visited in priority order, so the first culture to inject an entry wins (see FTextLocalizationResource::ShouldReplaceEntry)
+	for (const FString& Culture : InPrioritizedCultures)
 	{
-		if (!InPrioritizedCultures.Contains(CachedTranslation.Key))
+		if (const FTolgeeCultureIndexRef* CultureIndex = DataToInject->Cultures.Find(Culture))
 		{
-			continue;
+			InjectCulture(**CultureIndex, InOutLocalizedResource, LiveSourceStringHashes);
 		}
+	}
+}
 
-		for (const FTolgeeTranslationData& TranslationData : CachedTranslation.Value)
-		{
-			const FTextKey InNamespace = TranslationData.ParsedNamespace;
-			const FTextKey InKey = TranslationData.ParsedKey;
-			const FString InLocalizedString = TranslationData.Translation;
+int32 UTolgeeLocalizationInjectorSubsystem::InjectCulture(const FTolgeeCultureIndex& CultureIndex, FTextLocalizationResource& InOutLocalizedResource, TMap<FTextId, uint32>& OutLiveSourceStringHashes)
+{
+	int32 NumInjected = 0;
+	for (int32 EntryIndex = 0; EntryIndex < CultureIndex.Num(); ++EntryIndex)
+	{
+		const FTextId TextId = CultureIndex.GetId(EntryIndex);
 
-			if (FTextLocalizationResource::FEntry* ExistingEntry = InOutLocalizedResource.Entries.Find(FTextId(InNamespace, InKey)))
-			{
-				//NOTE: -1 is a higher than usual priority, meaning this entry will override any existing one. See FTextLocalizationResource::ShouldReplaceEntry 
-				InOutLocalizedResource.AddEntry(InNamespace, InKey, ExistingEntry->SourceStringHash, InLocalizedString, -1);
-			}
-			else
-			{
+		if (FTextLocalizationResource::FEntry* ExistingEntry = InOutLocalizedResource.Entries.Find(TextId))
+		{
+			//NOTE: -1 is a higher than usual priority, meaning this entry will override any existing one. See FTextLocalizationResource::ShouldReplaceEntry 
+			InOutLocalizedResource.AddEntry(TextId.GetNamespace(), TextId.GetKey(), ExistingEntry->SourceStringHash, FString(CultureIndex.GetTranslation(EntryIndex)), -1);
+			OutLiveSourceStringHashes.Add(TextId, ExistingEntry->SourceStringHash);
+			NumInjected++;
+		}
+		else
+		{
 #if UE_VERSION_NEWER_THAN(5, 5, 0)
-				const FString InNamespaceString = InNamespace.ToString();
-				const FString InKeyString = InKey.ToString();
+			const FString InNamespaceString = TextId.GetNamespace().ToString();
+			const FString InKeyString = TextId.GetKey().ToString();
 #else
-				const FString InNamespaceString = InNamespace.GetChars();
-				const FString InKeyString = InKey.GetChars();
+			const FString InNamespaceString = TextId.GetNamespace().GetChars();
+			const FString InKeyString = TextId.GetKey().GetChars();
 #endif
-				UE_LOG(LogTolgee, Warning, TEXT("Failed to inject translation for %s:%s. Default entry not found."), *InNamespaceString, *InKeyString);
-			}
+			UE_LOG(LogTolgee, Warning, TEXT("Failed to inject translation for %s:%s. Default entry not found."), *InNamespaceString, *InKeyString);
 		}
 	}
+
+	return NumInjected;
 }
 
-TMap<FString, TArray<FTolgeeTranslationData>> UTolgeeLocalizationInjectorSubsystem::GetDataToInject() const
+FTolgeeTranslationSnapshotPtr UTolgeeLocalizationInjectorSubsystem::GetDataToInject() const
 {
-	return {};
+	return SnapshotPublisher.Acquire();
+}
+
+void UTolgeeLocalizationInjectorSubsystem::PublishTranslations(const TMap<FString, FTolgeeCultureIndexRef>& Cultures)
+{
+	// NOTE: Subclasses own their working copy of the translations on the game thread, only the published snapshot is shared with the refresh thread.
+	check(IsInGameThread());
+
+	TSharedRef<FTolgeeTranslationSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FTolgeeTranslationSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Cultures = Cultures;
+
+	SnapshotPublisher.Publish(Snapshot);
 }
 
 void UTolgeeLocalizationInjectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -77,60 +105,155 @@ void UTolgeeLocalizationInjectorSubsystem::Initialize(FSubsystemCollectionBase&
 	FTextLocalizationManager::Get().RegisterTextSource(TextSource.ToSharedRef());
 
 	FWorldDelegates::OnStartGameInstance.AddUObject(this, &ThisClass::OnGameInstanceStart);
+	FTolgeeRefreshScheduler::Get().Register(this);
 
 #if WITH_EDITOR
 	FEditorDelegates::PrePIEEnded.AddUObject(this, &ThisClass::OnGameInstanceEnd);
 #endif
 }
 
-void UTolgeeLocalizationInjectorSubsystem::RefreshTranslationDataAsync()
+void UTolgeeLocalizationInjectorSubsystem::Deinitialize()
 {
-	UE_LOG(LogTolgee, Verbose, TEXT("RefreshTranslationDataAsync requested."));
+	FTolgeeRefreshScheduler::Get().Unregister(this);
 
-	AsyncTask(
-		ENamedThreads::AnyHiPriThreadHiPriTask,
-		[=]()
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(UTolgeeLocalizationInjectorSubsystem::RefreshResources)
+	Super::Deinitialize();
+}
 
-			UE_LOG(LogTolgee, Verbose, TEXT("RefreshTranslationDataAsync executing."));
+void UTolgeeLocalizationInjectorSubsystem::QueueRefresh()
+{
+	FTolgeeRefreshScheduler::Get().QueueRefresh();
+}
 
-			FTextLocalizationManager::Get().RefreshResources();
-		}
-	);
+bool UTolgeeLocalizationInjectorSubsystem::IsActiveCulture(const FString& Culture)
+{
+	const FString CurrentLanguage = FInternationalization::Get().GetCurrentLanguage()->GetName();
+	return FInternationalization::Get().GetPrioritizedCultureNames(CurrentLanguage).Contains(Culture);
 }
 
-TArray<FTolgeeTranslationData> UTolgeeLocalizationInjectorSubsystem::ExtractTranslationsFromPO(const FString& PoContent)
+bool UTolgeeLocalizationInjectorSubsystem::TryRefreshTranslationDataDelta()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTolgeeLocalizationInjectorSubsystem::ExtractTranslationsFromPO)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTolgeeLocalizationInjectorSubsystem::TryRefreshTranslationDataDelta)
 
-	TArray<FTolgeeTranslationData> Result;
+	const FTolgeeTranslationSnapshotPtr NewSnapshot = GetDataToInject();
 
-#if WITH_LOCALIZATION_MODULE
-	FPortableObjectFormatDOM PortableObject;
-	PortableObject.FromString(PoContent);
+	FScopeLock Lock(&InjectionCriticalSection);
 
-	for (auto EntryPairIter = PortableObject.GetEntriesIterator(); EntryPairIter; ++EntryPairIter)
+	if (!LastInjectedSnapshot || !NewSnapshot)
 	{
-		auto POEntry = EntryPairIter->Value;
-		if (POEntry->MsgId.IsEmpty() || POEntry->MsgStr.Num() == 0 || POEntry->MsgStr[0].IsEmpty())
+		return false;
+	}
+
+	const FString CurrentLanguage = FInternationalization::Get().GetCurrentLanguage()->GetName();
+	if (FInternationalization::Get().GetPrioritizedCultureNames(CurrentLanguage) != LastInjectedCultures)
+	{
+		return false;
+	}
+
+	// An active culture appearing or disappearing changes which values win, only a full refresh can sort that out. Other cultures are not injected at all.
+	for (const FString& Culture : LastInjectedCultures)
+	{
+		if (LastInjectedSnapshot->Cultures.Contains(Culture) != NewSnapshot->Cultures.Contains(Culture))
+		{
+			return false;
+		}
+	}
+
+	FTextLocalizationResource ChangedEntries;
+
+	for (int32 CultureIndex = 0; CultureIndex < LastInjectedCultures.Num(); ++CultureIndex)
+	{
+		const FTolgeeCultureIndexRef* NewIndex = NewSnapshot->Cultures.Find(LastInjectedCultures[CultureIndex]);
+		const FTolgeeCultureIndexRef* OldIndex = LastInjectedSnapshot->Cultures.Find(LastInjectedCultures[CultureIndex]);
+		if (!NewIndex || !OldIndex || *NewIndex == *OldIndex)
 		{
-			// We ignore the header entry or entries with no translation.
 			continue;
 		}
 
-		FTolgeeTranslationData TranslationData;
+		const FTolgeeCultureIndex& New = **NewIndex;
+		const FTolgeeCultureIndex& Old = **OldIndex;
+
+		// NOTE: Indices patched from each other share the chunks they didn't change, only the entries of the other chunks are compared.
+		// Entries only move between chunks that were both modified, so a removed entry is always found in a chunk that differs.
+		const int32 NumChunks = FMath::Max(New.NumChunks(), Old.NumChunks());
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			if (New.SharesChunk(Old, ChunkIndex))
+			{
+				continue;
+			}
+
+			const int32 ChunkStart = ChunkIndex << FTolgeeCultureIndex::ChunkShift;
+
+			// Entries that disappeared need the value from the other text sources, which only a full refresh can provide.
+			for (int32 OldEntryIndex = ChunkStart; OldEntryIndex < FMath::Min(Old.Num(), ChunkStart + FTolgeeCultureIndex::ChunkSize); ++OldEntryIndex)
+			{
+				if (New.Find(Old.GetId(OldEntryIndex)) == INDEX_NONE)
+				{
+					return false;
+				}
+			}
+
+			for (int32 EntryIndex = ChunkStart; EntryIndex < FMath::Min(New.Num(), ChunkStart + FTolgeeCultureIndex::ChunkSize); ++EntryIndex)
+			{
+				const FTextId TextId = New.GetId(EntryIndex);
+				const FStringView Translation = New.GetTranslation(EntryIndex);
+
+				const int32 OldEntryIndex = Old.Find(TextId);
+				if (OldEntryIndex != INDEX_NONE && Old.GetTranslation(OldEntryIndex).Equals(Translation, ESearchCase::CaseSensitive))
+				{
+					continue;
+				}
+
+				// Higher priority cultures keep overriding this entry, so there is nothing to patch.
+				bool bOverriddenByHigherPriority = false;
+				for (int32 HigherCultureIndex = 0; HigherCultureIndex < CultureIndex && !bOverriddenByHigherPriority; ++HigherCultureIndex)
+				{
+					const FTolgeeCultureIndexRef* HigherIndex = NewSnapshot->Cultures.Find(LastInjectedCultures[HigherCultureIndex]);
+					bOverriddenByHigherPriority = HigherIndex && (*HigherIndex)->Find(TextId) != INDEX_NONE;
+				}
+				if (bOverriddenByHigherPriority)
+				{
+					continue;
+				}
+
+				// NOTE: Entries are patched with the hash of the live entry, like the full refresh does (see InjectCulture).
+				const uint32* LiveSourceStringHash = LiveSourceStringHashes.Find(TextId);
+				if (!LiveSourceStringHash)
+				{
+					// An entry the last refresh already saw had no live entry to override and is skipped the same way.
+					// For a new entry only a full refresh can tell if there is one.
+					if (OldEntryIndex != INDEX_NONE)
+					{
+						continue;
+					}
+					return false;
+				}
+
+				ChangedEntries.AddEntry(TextId.GetNamespace(), TextId.GetKey(), *LiveSourceStringHash, FString(Translation), -1);
+			}
+		}
+	}
+
+	UE_LOG(LogTolgee, Verbose, TEXT("Delta refresh patching %d changed entries."), ChangedEntries.Entries.Num());
+
+	if (ChangedEntries.Entries.Num() > 0)
+	{
+		FTextLocalizationManager::Get().UpdateFromLocalizationResource(ChangedEntries);
+	}
 
-		constexpr ELocalizedTextCollapseMode InTextCollapseMode = ELocalizedTextCollapseMode::IdenticalTextIdAndSource;
-		constexpr EPortableObjectFormat InPOFormat = EPortableObjectFormat::Crowdin;
+	LastInjectedSnapshot = NewSnapshot;
+	return true;
+}
 
-		PortableObjectPipeline::ParseBasicPOFileEntry(*POEntry, TranslationData.ParsedNamespace, TranslationData.ParsedKey, TranslationData.SourceText, TranslationData.Translation, InTextCollapseMode, InPOFormat);
+FTolgeeCultureIndexRef UTolgeeLocalizationInjectorSubsystem::ExtractTranslationsFromPO(TConstArrayView<uint8> PoContent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTolgeeLocalizationInjectorSubsystem::ExtractTranslationsFromPO)
 
-		Result.Add(TranslationData);
+	FTolgeeCultureIndexBuilder Builder;
+	if (!TolgeePoParser::ParseIntoIndex(PoContent, Builder))
+	{
+		UE_LOG(LogTolgee, Error, TEXT("Failed to parse PO content. Only the %d entries before the error will be used."), Builder.Num());
 	}
-#else
-	UE_LOG(LogTolgee, Error, TEXT("Localization module is not available. Cannot extract translations from PO content."));
-#endif
 
-	return Result;
-}
\ No newline at end of file
+	return Builder.Build();
+}
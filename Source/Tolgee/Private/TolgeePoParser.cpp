@@ -0,0 +1,469 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeePoParser.h"
+
+#include <Containers/StringConv.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeLog.h"
+#include "TolgeePoScanner.h"
+
+namespace
+{
+	/**
+	 * Field of the current entry the next quoted string belongs to.
+	 */
+	enum class EPoField : uint8
+	{
+		None,
+		MsgCtxt,
+		MsgId,
+		MsgStr,
+		Ignored
+	};
+
+	/**
+	 * Raw UTF-8 values of the entry being parsed. The buffers are reused between entries to avoid allocations.
+	 */
+	struct FPoEntryBuffers
+	{
+		TArray<ANSICHAR> MsgCtxt;
+		TArray<ANSICHAR> MsgId;
+		TArray<ANSICHAR> MsgStr;
+		TArray<ANSICHAR> KeyComment;
+		bool bHasMsgStr = false;
+
+		void Reset()
+		{
+			MsgCtxt.Reset();
+			MsgId.Reset();
+			MsgStr.Reset();
+			KeyComment.Reset();
+			bHasMsgStr = false;
+		}
+	};
+
+	bool IsBlank(uint8 Char)
+	{
+		return Char == ' ' || Char == '\t';
+	}
+
+	bool IsLineEnd(uint8 Char)
+	{
+		return Char == '\n' || Char == '\r';
+	}
+
+	bool StartsWith(const uint8* Cursor, const uint8* End, const ANSICHAR* Prefix, int32 PrefixLength)
+	{
+		return End - Cursor >= PrefixLength && FMemory::Memcmp(Cursor, Prefix, PrefixLength) == 0;
+	}
+
+	/**
+	 * Appends the character represented by the escape sequence '\<Char>'. Unknown sequences are kept as they are.
+	 */
+	void AppendEscapedChar(uint8 Char, TArray<ANSICHAR>& Out)
+	{
+		switch (Char)
+		{
+			case 'n':
+				Out.Add('\n');
+				break;
+			case 't':
+				Out.Add('\t');
+				break;
+			case 'r':
+				Out.Add('\r');
+				break;
+			case '\\':
+				Out.Add('\\');
+				break;
+			case '"':
+				Out.Add('"');
+				break;
+			case 'a':
+				Out.Add('\a');
+				break;
+			case 'b':
+				Out.Add('\b');
+				break;
+			case 'f':
+				Out.Add('\f');
+				break;
+			case 'v':
+				Out.Add('\v');
+				break;
+			default:
+				Out.Add('\\');
+				Out.Add(static_cast<ANSICHAR>(Char));
+				break;
+		}
+	}
+
+	/**
+	 * Converts the UTF-8 buffer into the given string, reusing its allocation.
+	 * Returns false if the buffer is not valid UTF-8, invalid sequences are replaced during the conversion.
+	 */
+	bool Utf8ToString(const TArray<ANSICHAR>& Utf8, FString& Out)
+	{
+		Out.Reset(Utf8.Num());
+
+		const uint8* Begin = reinterpret_cast<const uint8*>(Utf8.GetData());
+		const uint8* End = Begin + Utf8.Num();
+		if (Begin == End)
+		{
+			return true;
+		}
+
+		// Fast path: plain ASCII only needs to be widened
+		const uint8* FirstNonAscii = TolgeePoScanner::FindNonAscii(Begin, End);
+		if (FirstNonAscii == End)
+		{
+			TArray<TCHAR>& Chars = Out.GetCharArray();
+			Chars.SetNumUninitialized(Utf8.Num() + 1);
+			TolgeePoScanner::WidenAscii(Begin, Utf8.Num(), Chars.GetData());
+			Chars[Utf8.Num()] = TEXT('\0');
+			return true;
+		}
+
+		const FUTF8ToTCHAR Converter(Utf8.GetData(), Utf8.Num());
+		Out.AppendChars(Converter.Get(), Converter.Length());
+
+		return TolgeePoScanner::IsValidUtf8(FirstNonAscii, End);
+	}
+
+	/**
+	 * Single pass PO tokenizer writing directly into a FTolgeeCultureIndexBuilder.
+	 */
+	class FPoParser
+	{
+	public:
+		FPoParser(TConstArrayView<uint8> InContent, FTolgeeCultureIndexBuilder& InBuilder) :
+			Cursor(InContent.GetData()),
+			End(InContent.GetData() + InContent.Num()),
+			Builder(InBuilder)
+		{
+		}
+
+		bool Parse()
+		{
+			// Skip the UTF-8 byte order mark
+			if (StartsWith(Cursor, End, "\xEF\xBB\xBF", 3))
+			{
+				Cursor += 3;
+			}
+
+			while (Cursor < End)
+			{
+				while (Cursor < End && IsBlank(*Cursor))
+				{
+					++Cursor;
+				}
+				if (Cursor == End)
+				{
+					break;
+				}
+
+				const uint8 Char = *Cursor;
+				if (IsLineEnd(Char))
+				{
+					FlushIfComplete();
+					SkipLine();
+				}
+				else if (Char == '#')
+				{
+					FlushIfComplete();
+					ParseComment();
+				}
+				else if (Char == '"')
+				{
+					if (!ParseString())
+					{
+						return false;
+					}
+				}
+				else if (!ParseKeyword())
+				{
+					return false;
+				}
+			}
+
+			FlushIfComplete();
+
+			if (NumInvalidEntries > 0)
+			{
+				UE_LOG(LogTolgee, Warning, TEXT("PO content contains %d entries with invalid UTF-8, invalid sequences were replaced."), NumInvalidEntries);
+			}
+
+			return true;
+		}
+
+	private:
+		/**
+		 * Moves the cursor past the end of the current line.
+		 */
+		void SkipLine()
+		{
+			while (Cursor < End && *Cursor != '\n')
+			{
+				++Cursor;
+			}
+			if (Cursor < End)
+			{
+				++Cursor;
+			}
+			++LineNumber;
+		}
+
+		/**
+		 * Reads comments, only the extracted "Key:" comment is relevant for the text identity.
+		 */
+		void ParseComment()
+		{
+			static const ANSICHAR KeyPrefix[] = "Key:";
+
+			const uint8* CommentStart = Cursor + 1;
+			if (CommentStart < End && *CommentStart == '.')
+			{
+				const uint8* Text = CommentStart + 1;
+				while (Text < End && IsBlank(*Text))
+				{
+					++Text;
+				}
+
+				if (StartsWith(Text, End, KeyPrefix, UE_ARRAY_COUNT(KeyPrefix) - 1))
+				{
+					const uint8* ValueStart = Text + UE_ARRAY_COUNT(KeyPrefix) - 1;
+					while (ValueStart < End && IsBlank(*ValueStart))
+					{
+						++ValueStart;
+					}
+					const uint8* ValueEnd = ValueStart;
+					while (ValueEnd < End && !IsLineEnd(*ValueEnd))
+					{
+						++ValueEnd;
+					}
+					while (ValueEnd > ValueStart && IsBlank(*(ValueEnd - 1)))
+					{
+						--ValueEnd;
+					}
+
+					Entry.KeyComment.Reset();
+					for (const uint8* Char = ValueStart; Char < ValueEnd; ++Char)
+					{
+						if (*Char == '\\' && Char + 1 < ValueEnd)
+						{
+							AppendEscapedChar(*++Char, Entry.KeyComment);
+						}
+						else
+						{
+							Entry.KeyComment.Add(static_cast<ANSICHAR>(*Char));
+						}
+					}
+				}
+			}
+
+			SkipLine();
+		}
+
+		/**
+		 * Reads a keyword (msgctxt, msgid, msgstr...) and the string following it on the same line.
+		 */
+		bool ParseKeyword()
+		{
+			const uint8* KeywordStart = Cursor;
+			while (Cursor < End && !IsBlank(*Cursor) && !IsLineEnd(*Cursor) && *Cursor != '"')
+			{
+				++Cursor;
+			}
+
+			const int32 KeywordLength = Cursor - KeywordStart;
+			const auto IsKeyword = [KeywordStart, KeywordLength](const ANSICHAR* Keyword)
+			{
+				return FCStringAnsi::Strlen(Keyword) == KeywordLength && FMemory::Memcmp(KeywordStart, Keyword, KeywordLength) == 0;
+			};
+
+			if (IsKeyword("msgctxt"))
+			{
+				FlushIfComplete();
+				CurrentField = EPoField::MsgCtxt;
+			}
+			else if (IsKeyword("msgid"))
+			{
+				FlushIfComplete();
+				CurrentField = EPoField::MsgId;
+			}
+			else if (IsKeyword("msgstr") || IsKeyword("msgstr[0]"))
+			{
+				Entry.bHasMsgStr = true;
+				CurrentField = EPoField::MsgStr;
+			}
+			else if (IsKeyword("msgid_plural") || StartsWith(KeywordStart, End, "msgstr[", 7))
+			{
+				CurrentField = EPoField::Ignored;
+			}
+			else
+			{
+				UE_LOG(LogTolgee, Warning, TEXT("Unknown keyword in PO content at line %d, skipping it."), LineNumber);
+				CurrentField = EPoField::Ignored;
+				SkipLine();
+				return true;
+			}
+
+			GetFieldBuffer(CurrentField).Reset();
+
+			while (Cursor < End && IsBlank(*Cursor))
+			{
+				++Cursor;
+			}
+			if (Cursor < End && *Cursor == '"')
+			{
+				return ParseString();
+			}
+
+			SkipLine();
+			return true;
+		}
+
+		/**
+		 * Decodes a quoted string into the current field and moves to the next line.
+		 */
+		bool ParseString()
+		{
+			TArray<ANSICHAR>& Out = GetFieldBuffer(CurrentField);
+
+			// Skip the opening quote
+			++Cursor;
+
+			for (;;)
+			{
+				const uint8* Delimiter = TolgeePoScanner::FindStringDelimiter(Cursor, End);
+				Out.Append(reinterpret_cast<const ANSICHAR*>(Cursor), Delimiter - Cursor);
+				Cursor = Delimiter;
+
+				if (Cursor == End || *Cursor == '\n')
+				{
+					UE_LOG(LogTolgee, Error, TEXT("Unterminated string in PO content at line %d."), LineNumber);
+					return false;
+				}
+
+				if (*Cursor == '"')
+				{
+					++Cursor;
+					break;
+				}
+
+				// Escape sequence
+				if (Cursor + 1 == End)
+				{
+					UE_LOG(LogTolgee, Error, TEXT("Unterminated escape sequence in PO content at line %d."), LineNumber);
+					return false;
+				}
+				AppendEscapedChar(Cursor[1], Out);
+				Cursor += 2;
+			}
+
+			SkipLine();
+			return true;
+		}
+
+		/**
+		 * Returns the buffer the given field is written to. Ignored fields share a scratch buffer.
+		 */
+		TArray<ANSICHAR>& GetFieldBuffer(EPoField Field)
+		{
+			switch (Field)
+			{
+				case EPoField::MsgCtxt:
+					return Entry.MsgCtxt;
+				case EPoField::MsgId:
+					return Entry.MsgId;
+				case EPoField::MsgStr:
+					return Entry.MsgStr;
+				default:
+					IgnoredBuffer.Reset();
+					return IgnoredBuffer;
+			}
+		}
+
+		/**
+		 * Adds the current entry to the builder once its msgstr was read and starts a new one.
+		 */
+		void FlushIfComplete()
+		{
+			if (!Entry.bHasMsgStr)
+			{
+				return;
+			}
+
+			// We ignore the header entry or entries with no translation.
+			if (!Entry.MsgId.IsEmpty() && !Entry.MsgStr.IsEmpty())
+			{
+				bool bValidUtf8 = Utf8ToString(Entry.MsgCtxt, Context);
+				if (!Entry.KeyComment.IsEmpty())
+				{
+					// Crowdin format: the namespace is stored in msgctxt and the key in an extracted comment.
+					Namespace = Context;
+					bValidUtf8 &= Utf8ToString(Entry.KeyComment, Key);
+				}
+				else
+				{
+					// Unreal format: msgctxt is "Namespace,Key".
+					int32 DelimiterIndex = INDEX_NONE;
+					Context.FindChar(TEXT(','), DelimiterIndex);
+
+					Namespace.Reset();
+					Key.Reset();
+					if (DelimiterIndex == INDEX_NONE)
+					{
+						Namespace = Context;
+					}
+					else
+					{
+						Namespace.AppendChars(*Context, DelimiterIndex);
+						Key.AppendChars(*Context + DelimiterIndex + 1, Context.Len() - DelimiterIndex - 1);
+					}
+				}
+
+				bValidUtf8 &= Utf8ToString(Entry.MsgId, SourceString);
+
+				FString Translation;
+				bValidUtf8 &= Utf8ToString(Entry.MsgStr, Translation);
+
+				if (!bValidUtf8)
+				{
+					++NumInvalidEntries;
+				}
+
+				Builder.Add(Namespace, Key, SourceString, MoveTemp(Translation));
+			}
+
+			Entry.Reset();
+			CurrentField = EPoField::None;
+		}
+
+		const uint8* Cursor;
+		const uint8* End;
+		int32 LineNumber = 1;
+		int32 NumInvalidEntries = 0;
+
+		FTolgeeCultureIndexBuilder& Builder;
+		FPoEntryBuffers Entry;
+		TArray<ANSICHAR> IgnoredBuffer;
+		EPoField CurrentField = EPoField::None;
+
+		FString Context;
+		FString Namespace;
+		FString Key;
+		FString SourceString;
+	};
+} // namespace
+
+bool TolgeePoParser::ParseIntoIndex(TConstArrayView<uint8> Utf8Content, FTolgeeCultureIndexBuilder& OutBuilder)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TolgeePoParser::ParseIntoIndex)
+
+	UE_LOG(LogTolgee, Verbose, TEXT("Parsing %d bytes of PO content using the %s scanner."), Utf8Content.Num(), TolgeePoScanner::GetKernelName());
+
+	FPoParser Parser(Utf8Content, OutBuilder);
+	return Parser.Parse();
+}
@@ -0,0 +1,258 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeePoScanner.h"
+
+#include <Math/UnrealMathUtility.h>
+
+#if defined(PLATFORM_ENABLE_VECTORINTRINSICS_NEON) && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#define TOLGEE_SCANNER_NEON 1
+#include <arm_neon.h>
+#elif defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#define TOLGEE_SCANNER_AVX2 1
+#include <immintrin.h>
+#elif PLATFORM_CPU_X86_FAMILY
+#define TOLGEE_SCANNER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifndef TOLGEE_SCANNER_NEON
+#define TOLGEE_SCANNER_NEON 0
+#endif
+#ifndef TOLGEE_SCANNER_AVX2
+#define TOLGEE_SCANNER_AVX2 0
+#endif
+#ifndef TOLGEE_SCANNER_SSE2
+#define TOLGEE_SCANNER_SSE2 0
+#endif
+
+namespace
+{
+	bool IsStringDelimiter(uint8 Char)
+	{
+		return Char == '"' || Char == '\\' || Char == '\n';
+	}
+
+#if TOLGEE_SCANNER_NEON
+	/**
+	 * Packs a 16 byte comparison result into a 64 bit mask with 4 bits per byte (NEON has no movemask).
+	 */
+	uint64 ToNibbleMask(uint8x16_t Match)
+	{
+		const uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8(Match), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0);
+	}
+#endif
+} // namespace
+
+const uint8* TolgeePoScanner::FindStringDelimiter(const uint8* Begin, const uint8* End)
+{
+	const uint8* Cursor = Begin;
+
+#if TOLGEE_SCANNER_AVX2
+	const __m256i Quote = _mm256_set1_epi8('"');
+	const __m256i Backslash = _mm256_set1_epi8('\\');
+	const __m256i LineFeed = _mm256_set1_epi8('\n');
+
+	for (; End - Cursor >= 32; Cursor += 32)
+	{
+		const __m256i Chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Cursor));
+		const __m256i Match = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(Chunk, Quote), _mm256_cmpeq_epi8(Chunk, Backslash)), _mm256_cmpeq_epi8(Chunk, LineFeed));
+		const uint32 Mask = static_cast<uint32>(_mm256_movemask_epi8(Match));
+		if (Mask != 0)
+		{
+			return Cursor + FMath::CountTrailingZeros(Mask);
+		}
+	}
+#elif TOLGEE_SCANNER_SSE2
+	const __m128i Quote = _mm_set1_epi8('"');
+	const __m128i Backslash = _mm_set1_epi8('\\');
+	const __m128i LineFeed = _mm_set1_epi8('\n');
+
+	for (; End - Cursor >= 16; Cursor += 16)
+	{
+		const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Cursor));
+		const __m128i Match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote), _mm_cmpeq_epi8(Chunk, Backslash)), _mm_cmpeq_epi8(Chunk, LineFeed));
+		const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(Match));
+		if (Mask != 0)
+		{
+			return Cursor + FMath::CountTrailingZeros(Mask);
+		}
+	}
+#elif TOLGEE_SCANNER_NEON
+	const uint8x16_t Quote = vdupq_n_u8('"');
+	const uint8x16_t Backslash = vdupq_n_u8('\\');
+	const uint8x16_t LineFeed = vdupq_n_u8('\n');
+
+	for (; End - Cursor >= 16; Cursor += 16)
+	{
+		const uint8x16_t Chunk = vld1q_u8(Cursor);
+		const uint8x16_t Match = vorrq_u8(vorrq_u8(vceqq_u8(Chunk, Quote), vceqq_u8(Chunk, Backslash)), vceqq_u8(Chunk, LineFeed));
+		const uint64 Mask = ToNibbleMask(Match);
+		if (Mask != 0)
+		{
+			return Cursor + (FMath::CountTrailingZeros64(Mask) >> 2);
+		}
+	}
+#endif
+
+	while (Cursor < End && !IsStringDelimiter(*Cursor))
+	{
+		++Cursor;
+	}
+	return Cursor;
+}
+
+const uint8* TolgeePoScanner::FindNonAscii(const uint8* Begin, const uint8* End)
+{
+	const uint8* Cursor = Begin;
+
+#if TOLGEE_SCANNER_AVX2
+	for (; End - Cursor >= 32; Cursor += 32)
+	{
+		const __m256i Chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Cursor));
+		const uint32 Mask = static_cast<uint32>(_mm256_movemask_epi8(Chunk));
+		if (Mask != 0)
+		{
+			return Cursor + FMath::CountTrailingZeros(Mask);
+		}
+	}
+#elif TOLGEE_SCANNER_SSE2
+	for (; End - Cursor >= 16; Cursor += 16)
+	{
+		const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Cursor));
+		const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(Chunk));
+		if (Mask != 0)
+		{
+			return Cursor + FMath::CountTrailingZeros(Mask);
+		}
+	}
+#elif TOLGEE_SCANNER_NEON
+	const uint8x16_t HighBit = vdupq_n_u8(0x80);
+
+	for (; End - Cursor >= 16; Cursor += 16)
+	{
+		const uint8x16_t Chunk = vld1q_u8(Cursor);
+		const uint64 Mask = ToNibbleMask(vtstq_u8(Chunk, HighBit));
+		if (Mask != 0)
+		{
+			return Cursor + (FMath::CountTrailingZeros64(Mask) >> 2);
+		}
+	}
+#endif
+
+	while (Cursor < End && *Cursor < 0x80)
+	{
+		++Cursor;
+	}
+	return Cursor;
+}
+
+bool TolgeePoScanner::IsValidUtf8(const uint8* Begin, const uint8* End)
+{
+	const uint8* Cursor = Begin;
+
+	for (;;)
+	{
+		Cursor = FindNonAscii(Cursor, End);
+		if (Cursor == End)
+		{
+			return true;
+		}
+
+		const uint8 Lead = *Cursor;
+
+		int32 Length = 0;
+		uint32 CodePoint = 0;
+		uint32 MinCodePoint = 0;
+		if ((Lead & 0xE0) == 0xC0)
+		{
+			Length = 2;
+			CodePoint = Lead & 0x1F;
+			MinCodePoint = 0x80;
+		}
+		else if ((Lead & 0xF0) == 0xE0)
+		{
+			Length = 3;
+			CodePoint = Lead & 0x0F;
+			MinCodePoint = 0x800;
+		}
+		else if ((Lead & 0xF8) == 0xF0)
+		{
+			Length = 4;
+			CodePoint = Lead & 0x07;
+			MinCodePoint = 0x10000;
+		}
+		else
+		{
+			return false;
+		}
+
+		if (End - Cursor < Length)
+		{
+			return false;
+		}
+
+		for (int32 Index = 1; Index < Length; ++Index)
+		{
+			const uint8 Continuation = Cursor[Index];
+			if ((Continuation & 0xC0) != 0x80)
+			{
+				return false;
+			}
+			CodePoint = (CodePoint << 6) | (Continuation & 0x3F);
+		}
+
+		if (CodePoint < MinCodePoint || CodePoint > 0x10FFFF || (CodePoint >= 0xD800 && CodePoint <= 0xDFFF))
+		{
+			return false;
+		}
+
+		Cursor += Length;
+	}
+}
+
+void TolgeePoScanner::WidenAscii(const uint8* Source, int32 Num, TCHAR* Dest)
+{
+	int32 Index = 0;
+
+#if TOLGEE_SCANNER_SSE2 || TOLGEE_SCANNER_AVX2
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Num - Index >= 16; Index += 16)
+		{
+			const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm_unpacklo_epi8(Chunk, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index + 8), _mm_unpackhi_epi8(Chunk, Zero));
+		}
+	}
+#elif TOLGEE_SCANNER_NEON
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+		for (; Num - Index >= 16; Index += 16)
+		{
+			const uint8x16_t Chunk = vld1q_u8(Source + Index);
+			vst1q_u16(reinterpret_cast<uint16*>(Dest + Index), vmovl_u8(vget_low_u8(Chunk)));
+			vst1q_u16(reinterpret_cast<uint16*>(Dest + Index + 8), vmovl_u8(vget_high_u8(Chunk)));
+		}
+	}
+#endif
+
+	for (; Index < Num; ++Index)
+	{
+		Dest[Index] = static_cast<TCHAR>(Source[Index]);
+	}
+}
+
+const TCHAR* TolgeePoScanner::GetKernelName()
+{
+#if TOLGEE_SCANNER_AVX2
+	return TEXT("AVX2");
+#elif TOLGEE_SCANNER_SSE2
+	return TEXT("SSE2");
+#elif TOLGEE_SCANNER_NEON
+	return TEXT("NEON");
+#else
+	return TEXT("Scalar");
+#endif
+}
@@ -0,0 +1,120 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeRefreshScheduler.h"
+
+#include <Internationalization/TextLocalizationManager.h>
+
+#include "TolgeeLocalizationInjectorSubsystem.h"
+#include "TolgeeLog.h"
+#include "TolgeeRuntimeSettings.h"
+
+DECLARE_STATS_GROUP(TEXT("Tolgee"), STATGROUP_Tolgee, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Refreshes requested"), STAT_TolgeeRefreshesRequested, STATGROUP_Tolgee);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Refreshes executed"), STAT_TolgeeRefreshesExecuted, STATGROUP_Tolgee);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Refreshes avoided"), STAT_TolgeeRefreshesAvoided, STATGROUP_Tolgee);
+
+FTolgeeRefreshScheduler& FTolgeeRefreshScheduler::Get()
+{
+	static FTolgeeRefreshScheduler Instance;
+	return Instance;
+}
+
+FTolgeeRefreshScheduler::FTolgeeRefreshScheduler() :
+	Generation(0),
+	NumPendingRefreshes(0),
+	RefreshPipe(TEXT("TolgeeRefreshPipe"))
+{
+}
+
+void FTolgeeRefreshScheduler::Register(UTolgeeLocalizationInjectorSubsystem* Subsystem)
+{
+	check(IsInGameThread());
+
+	Subsystems.AddUnique(Subsystem);
+}
+
+void FTolgeeRefreshScheduler::Unregister(UTolgeeLocalizationInjectorSubsystem* Subsystem)
+{
+	check(IsInGameThread());
+
+	Subsystems.Remove(Subsystem);
+}
+
+void FTolgeeRefreshScheduler::QueueRefresh()
+{
+	check(IsInGameThread());
+
+	INC_DWORD_STAT(STAT_TolgeeRefreshesRequested);
+
+	if (QueuedRefreshHandle.IsValid())
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Refresh already queued, collapsing request."));
+		INC_DWORD_STAT(STAT_TolgeeRefreshesAvoided);
+		return;
+	}
+
+	// NOTE: The delay is never 0 so requests made during the same frame are collapsed as well.
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	const double TimeSinceLastRefresh = FPlatformTime::Seconds() - LastRefreshTime;
+	const float Delay = FMath::Max(static_cast<float>(Settings->MinRefreshInterval - TimeSinceLastRefresh), UE_SMALL_NUMBER);
+
+	QueuedRefreshHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTolgeeRefreshScheduler::OnQueuedRefreshTick), Delay);
+}
+
+bool FTolgeeRefreshScheduler::IsIdle() const
+{
+	return !QueuedRefreshHandle.IsValid() && NumPendingRefreshes == 0;
+}
+
+bool FTolgeeRefreshScheduler::OnQueuedRefreshTick(float DeltaTime)
+{
+	QueuedRefreshHandle.Reset();
+
+	Subsystems.RemoveAll([](const TWeakObjectPtr<UTolgeeLocalizationInjectorSubsystem>& Subsystem) { return !Subsystem.IsValid(); });
+
+	// NOTE: A refresh that is already executing might have read the snapshots before the ones that triggered this request were published, so a new refresh is always started.
+	LastRefreshTime = FPlatformTime::Seconds();
+	const uint32 RefreshGeneration = ++Generation;
+	++NumPendingRefreshes;
+
+	UE_LOG(LogTolgee, Verbose, TEXT("Refresh requested (generation %u)."), RefreshGeneration);
+
+	RefreshPipe.Launch(
+		TEXT("TolgeeRefresh"),
+		[this, RefreshGeneration, RefreshedSubsystems = Subsystems]()
+		{
+			ExecuteRefresh(RefreshGeneration, RefreshedSubsystems);
+			--NumPendingRefreshes;
+		},
+		UE::Tasks::ETaskPriority::High
+	);
+
+	return false;
+}
+
+void FTolgeeRefreshScheduler::ExecuteRefresh(uint32 RefreshGeneration, const TArray<TWeakObjectPtr<UTolgeeLocalizationInjectorSubsystem>>& RefreshedSubsystems)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FTolgeeRefreshScheduler::ExecuteRefresh)
+
+	// NOTE: A newer refresh was started while this one waited for the previous one, and it will pick up the latest snapshots anyway.
+	if (RefreshGeneration != Generation)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Refresh skipped stale generation %u."), RefreshGeneration);
+		INC_DWORD_STAT(STAT_TolgeeRefreshesAvoided);
+		return;
+	}
+
+	UE_LOG(LogTolgee, Verbose, TEXT("Refresh executing (generation %u) for %d subsystems."), RefreshGeneration, RefreshedSubsystems.Num());
+	INC_DWORD_STAT(STAT_TolgeeRefreshesExecuted);
+
+	// A full refresh reloads the resources of every subsystem, so there is no point in patching the remaining ones.
+	for (const TWeakObjectPtr<UTolgeeLocalizationInjectorSubsystem>& Subsystem : RefreshedSubsystems)
+	{
+		UTolgeeLocalizationInjectorSubsystem* RefreshedSubsystem = Subsystem.Get();
+		if (RefreshedSubsystem && !RefreshedSubsystem->TryRefreshTranslationDataDelta())
+		{
+			FTextLocalizationManager::Get().RefreshResources();
+			return;
+		}
+	}
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeTranslationSnapshot.h"
+
+#include <HAL/PlatformProcess.h>
+#include <Misc/ScopeLock.h>
+
+FTolgeeSnapshotPublisher::FTolgeeSnapshotPublisher()
+{
+	NumReaders[0] = 0;
+	NumReaders[1] = 0;
+	CurrentSlot = 0;
+}
+
+void FTolgeeSnapshotPublisher::Publish(FTolgeeTranslationSnapshotPtr NewSnapshot)
+{
+	FScopeLock Lock(&PublishCriticalSection);
+
+	const int32 NextSlot = 1 - CurrentSlot;
+
+	// NOTE: Readers that loaded the previous index might still be copying this slot. They only hold it for a pointer copy, so a short spin is enough.
+	while (NumReaders[NextSlot] != 0)
+	{
+		FPlatformProcess::Yield();
+	}
+
+	Slots[NextSlot] = MoveTemp(NewSnapshot);
+	CurrentSlot = NextSlot;
+}
+
+FTolgeeTranslationSnapshotPtr FTolgeeSnapshotPublisher::Acquire() const
+{
+	for (;;)
+	{
+		const int32 Slot = CurrentSlot;
+		++NumReaders[Slot];
+
+		// If a writer switched slots between our load and increment, the slot might be getting overwritten so we retry with the new one.
+		if (Slot == CurrentSlot)
+		{
+			FTolgeeTranslationSnapshotPtr Result = Slots[Slot];
+			--NumReaders[Slot];
+			return Result;
+		}
+
+		--NumReaders[Slot];
+	}
+}
@@ -2,7 +2,9 @@
 
 #include "TolgeeUtils.h"
 
+#include <HttpModule.h>
 #include <Interfaces/IPluginManager.h>
+#include <Misc/Compression.h>
 
 FString TolgeeUtils::AppendQueryParameters(const FString& BaseUrl, const TArray<FString>& Parameters)
 {
@@ -38,4 +40,77 @@ void TolgeeUtils::AddSdkHeaders(FHttpRequestRef& HttpRequest)
 {
 	HttpRequest->SetHeader(TEXT("X-Tolgee-SDK-Type"), GetSdkType());
 	HttpRequest->SetHeader(TEXT("X-Tolgee-SDK-Version"), GetSdkVersion());
-}
\ No newline at end of file
+}
+
+bool TolgeeUtils::IsGzipCompressed(TConstArrayView<uint8> Content)
+{
+	return Content.Num() >= 2 && Content[0] == 0x1F && Content[1] == 0x8B;
+}
+
+bool TolgeeUtils::DecompressGzip(TConstArrayView<uint8> Content, TArray<uint8>& OutContent)
+{
+	// NOTE: Smallest valid gzip member is a 10 byte header followed by an empty deflate block and an 8 byte trailer.
+	if (!IsGzipCompressed(Content) || Content.Num() < 18)
+	{
+		return false;
+	}
+
+	// NOTE: ISIZE is stored little endian in the last 4 bytes and deflate can't expand data more than 1032 times, anything bigger is corrupted.
+	const uint8* Trailer = Content.GetData() + Content.Num() - 4;
+	const uint32 UncompressedSize = Trailer[0] | (Trailer[1] << 8) | (Trailer[2] << 16) | (static_cast<uint32>(Trailer[3]) << 24);
+	if (UncompressedSize > MAX_int32 || UncompressedSize > static_cast<uint64>(Content.Num()) * 1032)
+	{
+		return false;
+	}
+
+	OutContent.SetNumUninitialized(UncompressedSize);
+	if (!FCompression::UncompressMemory(NAME_Gzip, OutContent.GetData(), OutContent.Num(), Content.GetData(), Content.Num()))
+	{
+		OutContent.Empty();
+		return false;
+	}
+
+	return true;
+}
+
+bool TolgeeUtils::DecodeContent(TConstArrayView<uint8> Content, TArray<uint8>& Buffer, TConstArrayView<uint8>& OutContent)
+{
+	if (!IsGzipCompressed(Content))
+	{
+		OutContent = Content;
+		return true;
+	}
+
+	if (!DecompressGzip(Content, Buffer))
+	{
+		OutContent = {};
+		return false;
+	}
+
+	OutContent = Buffer;
+	return true;
+}
+
+FHttpRequestRef TolgeeUtils::CreateCdnRequest(const FString& Url)
+{
+	const FHttpRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetVerb("GET");
+	HttpRequest->SetURL(Url);
+	HttpRequest->SetHeader(TEXT("accept"), TEXT("application/json"));
+	HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
+	return HttpRequest;
+}
+
+TFuture<FHttpResponsePtr> TolgeeUtils::ProcessRequestAsync(FHttpRequestRef HttpRequest)
+{
+	TSharedRef<TPromise<FHttpResponsePtr>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FHttpResponsePtr>, ESPMode::ThreadSafe>();
+	TFuture<FHttpResponsePtr> Result = Promise->GetFuture();
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([Promise](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	{
+		Promise->SetValue(bWasSuccessful ? Response : nullptr);
+	});
+	HttpRequest->ProcessRequest();
+
+	return Result;
+}
@@ -0,0 +1,86 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/ArrayView.h>
+#include <Containers/UnrealString.h>
+#include <Misc/Optional.h>
+
+#include "TolgeeCultureIndex.h"
+
+/**
+ * Validators and identity of a CDN file stored on disk.
+ */
+struct FTolgeeCdnCacheEntry
+{
+	/**
+	 * Url the content was downloaded from.
+	 */
+	FString Url;
+	/**
+	 * Culture the content belongs to.
+	 */
+	FString Culture;
+	/**
+	 * Value of the Last-Modified header returned with the content, sent back as If-Modified-Since.
+	 */
+	FString LastModified;
+	/**
+	 * Value of the ETag header returned with the content, sent back as If-None-Match.
+	 */
+	FString ETag;
+	/**
+	 * SHA1 (hex) of the uncompressed content, compared against the CDN manifest.
+	 */
+	FString ContentHash;
+	/**
+	 * Size in bytes of the uncompressed content.
+	 */
+	int64 ContentSize = 0;
+	/**
+	 * Position of the CDN address the file comes from in the settings. Later layers override earlier ones. Not persisted.
+	 */
+	int32 Layer = 0;
+};
+
+/**
+ * Persistent cache of the CDN responses stored under Saved/Tolgee/Cdn so they survive between sessions.
+ * Each url is stored as two files named after the hash of the url: the parsed translations in binary form (.bin, see TolgeeCultureIndexFile) and the validators (.json).
+ * Loading also looks into the baseline baked into the packaged build by the TolgeeBakeCdnData commandlet, so the first launch doesn't start empty.
+ * Functions touching the disk are safe to call from any thread.
+ */
+namespace TolgeeCdnCache
+{
+	/**
+	 * @brief Directory where the cached CDN files are stored
+	 */
+	FString TOLGEE_API GetCacheDirectory();
+	/**
+	 * @brief Directory where the commandlet bakes the CDN files, it has to be staged with the packaged build (DirectoriesToAlwaysStageAsUFS)
+	 */
+	FString TOLGEE_API GetBakedDirectory();
+	/**
+	 * @brief Url of the culture file on the CDN address
+	 */
+	FString TOLGEE_API GetFileUrl(const FString& CdnAddress, const FString& Culture);
+	/**
+	 * @brief Files (url, culture and layer) the configured CDN addresses serve for the cultures
+	 */
+	TArray<FTolgeeCdnCacheEntry> TOLGEE_API GetFiles(const TArray<FString>& Cultures);
+	/**
+	 * @brief Reads the validators stored for the url. Returns false if the url was never cached.
+	 */
+	bool TOLGEE_API LoadEntry(const FString& Url, FTolgeeCdnCacheEntry& OutEntry);
+	/**
+	 * @brief Reads the translations stored for the entry. Unset if they were never cached or don't match the content hash of the entry.
+	 */
+	TOptional<FTolgeeCultureIndexRef> TOLGEE_API LoadTranslations(const FTolgeeCdnCacheEntry& Entry);
+	/**
+	 * @brief Hashes content the same way the CDN manifest does
+	 */
+	FString TOLGEE_API HashContent(TConstArrayView<uint8> Content);
+	/**
+	 * @brief Stores the parsed translations and the validators of a response. The validators are written last so an interrupted save never pairs new validators with old translations.
+	 */
+	bool TOLGEE_API Save(const FTolgeeCdnCacheEntry& Entry, const FTolgeeCultureIndex& Translations, const FString& Directory = GetCacheDirectory());
+} // namespace TolgeeCdnCache
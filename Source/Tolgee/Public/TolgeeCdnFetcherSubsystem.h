@@ -4,10 +4,44 @@
 
 #include "TolgeeLocalizationInjectorSubsystem.h"
 
+#include <Engine/TimerHandle.h>
 #include <Interfaces/IHttpRequest.h>
 
+class FJsonObject;
+
+#include "TolgeeCdnCache.h"
+#include "TolgeeCdnLatencyStats.h"
+#include "TolgeeLayeredCultureIndex.h"
+
 #include "TolgeeCdnFetcherSubsystem.generated.h"
 
+/**
+ * State of a file requested from multiple CDN mirrors at once.
+ */
+struct FTolgeeMirrorFetch
+{
+	/**
+	 * File being fetched, identified by the url of the first mirror.
+	 */
+	FTolgeeCdnCacheEntry File;
+	/**
+	 * Mirror addresses ordered from the fastest to the slowest known one.
+	 */
+	TArray<FString> Mirrors;
+	/**
+	 * Index of the next mirror to send the request to.
+	 */
+	int32 NextMirror = 0;
+	/**
+	 * Requests currently in flight, the first one to answer wins and the rest are cancelled.
+	 */
+	TArray<FHttpRequestPtr> Requests;
+	/**
+	 * Timer sending the request to the next mirror if the current ones take longer than usual.
+	 */
+	FTimerHandle HedgeTimer;
+};
+
 /**
  * Subsystem responsible for fetching localization data from a CDN and injecting it into the game.
  */
@@ -19,29 +53,126 @@ class UTolgeeCdnFetcherSubsystem : public UTolgeeLocalizationInjectorSubsystem
 	// ~ Begin UTolgeeLocalizationInjectorSubsystem interface
 	virtual void OnGameInstanceStart(UGameInstance* GameInstance) override;
 	virtual void OnGameInstanceEnd(bool bIsSimulating) override;
-	virtual TMap<FString, TArray<FTolgeeTranslationData>> GetDataToInject() const override;
 	// ~ End UTolgeeLocalizationInjectorSubsystem interface
 
 	/**
-	 * Runs multiple requests to fetch all projects from the CDN.
+	 * Callback executed when the current culture changes. Loads the new culture and its fallbacks if they were not requested yet.
+	 */
+	void OnCultureChanged();
+	/**
+	 * Returns the current culture and its fallbacks (in priority order) that are localized in this project.
+	 */
+	TArray<FString> GetActiveCultures() const;
+	/**
+	 * Loads the cultures that were not requested yet from the disk cache and the CDN.
+	 */
+	void LoadCultures(const TArray<FString>& Cultures);
+	/**
+	 * Loads the CDN responses persisted by previous sessions, injects them and then revalidates them against the CDN.
 	 */
-	void FetchAllCdns();
+	void LoadCachedData(const TArray<FTolgeeCdnCacheEntry>& Files);
+	/**
+	 * Callback executed on the game thread once the persisted CDN responses were parsed on a worker thread.
+	 */
+	void OnCachedDataLoaded(const TArray<FTolgeeCdnCacheEntry>& Files, const TArray<TOptional<FTolgeeCultureIndexRef>>& Translations, int32 Generation);
+	/**
+	 * Runs multiple requests to fetch the files from the CDN.
+	 */
+	void FetchCdnFiles(const TArray<FTolgeeCdnCacheEntry>& Files);
+	/**
+	 * Fetches a single file from its CDN address or from the mirrors.
+	 */
+	void FetchFile(const FTolgeeCdnCacheEntry& File);
+	/**
+	 * Fetches the manifest of the CDN address to find out which of its files changed.
+	 */
+	void FetchManifest(const FString& CdnAddress, const TArray<FTolgeeCdnCacheEntry>& Files);
+	/**
+	 * Callback function for when the manifest request is completed. Fetches the files whose content differs from the cached one.
+	 * Responses to requests sent before the data was reset (older Generation) are ignored.
+	 */
+	void OnFetchedManifest(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TArray<FTolgeeCdnCacheEntry> Files, int32 Generation);
+	/**
+	 * Returns true if the cached content of the file matches the hash and size listed in the manifest.
+	 */
+	bool IsUpToDate(const FTolgeeCdnCacheEntry& File, const FJsonObject& ManifestFiles) const;
 	/**
 	 * Fetches the localization data from the CDN.
 	 */
-	void FetchFromCdn(const FString& Culture, const FString& DownloadUrl);
+	void FetchFromCdn(const FTolgeeCdnCacheEntry& File);
+	/**
+	 * Creates a GET request for the download url using the validators stored for the file url.
+	 */
+	FHttpRequestRef CreateCdnRequest(const FString& FileUrl, const FString& DownloadUrl) const;
+	/**
+	 * Fetches the file from the fastest known mirror and hedges to the next ones if it takes longer than usual.
+	 */
+	void FetchFromMirrors(const FTolgeeCdnCacheEntry& File);
+	/**
+	 * Sends the request for the file to the next mirror in latency order.
+	 */
+	void SendToNextMirror(const FString& FileUrl);
+	/**
+	 * Callback function for when a request to a mirror is completed.
+	 */
+	void OnFetchedFromMirror(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString FileUrl, FString Mirror);
+	/**
+	 * Stops the hedge timer and cancels all requests still in flight for the mirror fetch.
+	 */
+	void CancelMirrorFetch(FTolgeeMirrorFetch& MirrorFetch);
 	/**
-	 * Callback function for when the CDN request is completed.
+	 * Callback function for when the CDN request is completed. Responses to requests sent before the data was reset (older Generation) are ignored.
 	 */
-	void OnFetchedFromCdn(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString InCutlure);
+	void OnFetchedFromCdn(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FTolgeeCdnCacheEntry File, int32 Generation);
+	/**
+	 * Handles the response for a file, regardless of which CDN address answered it.
+	 */
+	void ProcessCdnResponse(const FTolgeeCdnCacheEntry& File, FHttpResponsePtr Response, bool bWasSuccessful);
+	/**
+	 * Callback executed on the game thread once the content of a CDN response was decompressed and parsed on a worker thread.
+	 * Translations are unset if the content could not be decoded.
+	 */
+	void OnTranslationsParsed(const FTolgeeCdnCacheEntry& CacheEntry, const TOptional<FTolgeeCultureIndexRef>& Translations, int32 Generation);
+	/**
+	 * Merges the translations of a file into its culture, files of later CDN addresses override earlier ones.
+	 */
+	void MergeTranslations(const FTolgeeCdnCacheEntry& File, const FTolgeeCultureIndexRef& Translations);
+	/**
+	 * Marks a request as completed and publishes the background cultures once all of them are done.
+	 */
+	void OnRequestCompleted();
+	/**
+	 * Loads the next culture waiting in the prefetch queue if no request is in flight. Called again once it completes.
+	 */
+	void PrefetchNextCulture();
+	/**
+	 * Schedules the next conditional poll of the CDN if polling is enabled and not already scheduled.
+	 */
+	void SchedulePoll();
+	/**
+	 * Revalidates all requested files against the CDN.
+	 */
+	void OnPollTick();
+	/**
+	 * Callback executed when the application goes to the background. Pauses the polling.
+	 */
+	void OnApplicationDeactivated();
+	/**
+	 * Callback executed when the application returns to the foreground. Resumes the polling.
+	 */
+	void OnApplicationReactivated();
 	/**
 	 * Clears the cached translations and resets the request counters.
 	 */
 	void ResetData();
 	/**
-	 * List of cached translations for each culture.
+	 * Translations of each culture split by CDN address (layer).
+	 */
+	TMap<FString, FTolgeeLayeredCultureIndex> LayeredCultures;
+	/**
+	 * List of cached translations for each culture, merged across all layers. Only accessed on the game thread.
 	 */
-	TMap<FString, TArray<FTolgeeTranslationData>> CachedTranslations;
+	TMap<FString, FTolgeeCultureIndexRef> CachedTranslations;
 	/**
 	 * Counts the number of requests sent.
 	 */
@@ -51,7 +182,55 @@ class UTolgeeCdnFetcherSubsystem : public UTolgeeLocalizationInjectorSubsystem
 	 */
 	int32 NumRequestsCompleted = 0;
 	/**
-	 * Map storing the last modified dates of the translations.
+	 * Incremented every time the data is reset, so results parsed for a previous fetch are discarded.
+	 */
+	int32 FetchGeneration = 0;
+	/**
+	 * True if a request brought new data since the translations were last published.
+	 */
+	bool bHasPendingChanges = false;
+	/**
+	 * Background cultures which received new translations that were merged but not published yet.
+	 */
+	TSet<FString> UnpublishedCultures;
+	/**
+	 * True if a request failed since the last time all requests completed.
+	 */
+	bool bHasFailedRequests = false;
+	/**
+	 * Current delay between two polls, grows while the CDN data doesn't change.
+	 */
+	float CurrentPollingInterval = 0.0f;
+	/**
+	 * True while the application is in the background.
+	 */
+	bool bPollingPaused = false;
+	/**
+	 * Timer triggering the next poll.
+	 */
+	FTimerHandle PollingTimer;
+	/**
+	 * Cultures that were already requested from the CDN during this session.
+	 */
+	TSet<FString> RequestedCultures;
+	/**
+	 * Cultures downloaded in the background after the active ones under the ActiveCulturesFirst policy, in localization order.
+	 */
+	TArray<FString> PrefetchQueue;
+	/**
+	 * Validators of the translations we currently have, keyed by url. Sent back to the CDN so unchanged files are answered with 304.
+	 */
+	TMap<FString, FTolgeeCdnCacheEntry> CacheEntries;
+	/**
+	 * Files currently requested from mirrors, keyed by file url.
+	 */
+	TMap<FString, FTolgeeMirrorFetch> MirrorFetches;
+	/**
+	 * Response times of the CDN addresses, used to pick the fastest mirror.
+	 */
+	FTolgeeCdnLatencyStats LatencyStats;
+	/**
+	 * Game instance we are fetching for, used to schedule timers.
 	 */
-	TMap<FString, FString> LastModifiedDates;
+	TWeakObjectPtr<UGameInstance> ActiveGameInstance;
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <Containers/UnrealString.h>
+#include <Misc/Optional.h>
+
+/**
+ * Keeps the most recent response times of each CDN address and persists them under Saved/Tolgee so the fastest mirror is known at boot.
+ */
+class TOLGEE_API FTolgeeCdnLatencyStats
+{
+public:
+	/**
+	 * Reads the statistics stored by previous sessions.
+	 */
+	void Load();
+	/**
+	 * Serializes the statistics on the calling thread and writes them to disk on a worker. Writes are never reordered, an older snapshot never overwrites a newer one.
+	 */
+	void SaveAsync() const;
+	/**
+	 * Records the time (in seconds) it took the address to answer a request.
+	 */
+	void AddSample(const FString& Address, double Seconds);
+	/**
+	 * Returns the latency under which the given fraction (0-1) of the recorded requests completed, unset if the address has no samples.
+	 */
+	TOptional<double> GetPercentile(const FString& Address, float Percentile) const;
+	/**
+	 * Orders the addresses from the fastest to the slowest median latency. Addresses without samples keep their relative order and go last.
+	 */
+	TArray<FString> SortByLatency(const TArray<FString>& Addresses) const;
+
+private:
+	/**
+	 * Location of the persisted statistics.
+	 */
+	static FString GetFilePath();
+	/**
+	 * Most recent samples of each address, oldest first.
+	 */
+	TMap<FString, TArray<double>> Samples;
+};
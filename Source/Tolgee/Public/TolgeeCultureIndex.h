@@ -0,0 +1,246 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <Containers/StringView.h>
+#include <Internationalization/TextKey.h>
+#include <Templates/SharedPointer.h>
+
+class FTolgeeCultureIndex;
+class FTolgeeCultureIndexStorage;
+
+using FTolgeeCultureIndexRef = TSharedRef<const FTolgeeCultureIndex, ESPMode::ThreadSafe>;
+using FTolgeeCultureIndexStorageRef = TSharedRef<const FTolgeeCultureIndexStorage, ESPMode::ThreadSafe>;
+
+/**
+ * Entries laid out in memory the index doesn't own, e.g. a memory mapped cache file, kept alive as long as an index reads from them.
+ * Strings are null terminated and read in place, they are only copied when an entry is modified or injected.
+ */
+class TOLGEE_API FTolgeeCultureIndexStorage
+{
+public:
+	/**
+	 * Single entry, strings are given as offset/length pairs into the pool.
+	 */
+	struct FEntry
+	{
+		uint32 NamespaceOffset;
+		uint32 NamespaceLength;
+		uint32 KeyOffset;
+		uint32 KeyLength;
+		uint32 TranslationOffset;
+		uint32 TranslationLength;
+		uint32 SourceStringHash;
+	};
+
+	/**
+	 * Position of an entry in the lookup, next to the hash of its FTextId.
+	 */
+	struct FLookupEntry
+	{
+		uint32 IdHash;
+		uint32 Position;
+	};
+
+	virtual ~FTolgeeCultureIndexStorage() = default;
+
+	const FEntry* Entries = nullptr;
+	int32 NumEntries = 0;
+	const TCHAR* Pool = nullptr;
+	/**
+	 * Every entry sorted by lookup bucket, then by id hash.
+	 */
+	const FLookupEntry* Lookup = nullptr;
+	/**
+	 * Start of each lookup bucket in Lookup, followed by the end of the last one.
+	 */
+	const uint32* LookupBucketStarts = nullptr;
+};
+
+/**
+ * Translations of a single culture, pre-keyed for injection.
+ * Never modified once built. Entries are stored in fixed size chunks of contiguous arrays, so an index derived from another one shares every chunk it didn't change.
+ */
+class TOLGEE_API FTolgeeCultureIndex
+{
+public:
+	/**
+	 * Source string hash used by translations whose source string is not known. The injection replaces it with the hash of the live entry.
+	 */
+	static constexpr uint32 UnknownSourceStringHash = 0;
+
+	/**
+	 * Number of consecutive entries stored together, patches copy whole chunks.
+	 */
+	static constexpr int32 ChunkShift = 10;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+	static constexpr int32 ChunkMask = ChunkSize - 1;
+	static constexpr int32 NumLookupBuckets = 64;
+
+	FTolgeeCultureIndex();
+
+	/**
+	 * Creates an index reading its entries and lookup in place from the storage, nothing is copied.
+	 */
+	static FTolgeeCultureIndexRef CreateFromStorage(const FTolgeeCultureIndexStorageRef& Storage);
+	/**
+	 * Lookup bucket the id hash (GetTypeHash of the FTextId) falls into.
+	 */
+	static int32 GetLookupBucketIndex(uint32 IdHash);
+
+	/**
+	 * Number of translations stored in the index.
+	 */
+	int32 Num() const { return NumEntries; }
+	/**
+	 * Identity of the translated text at the given position.
+	 * NOTE: Entries read from a storage build their text keys on every call.
+	 */
+	FTextId GetId(int32 EntryIndex) const
+	{
+		const FChunk& Chunk = GetChunk(EntryIndex);
+		if (Chunk.Storage.IsValid())
+		{
+			const FTolgeeCultureIndexStorage::FEntry& Entry = Chunk.GetStorageEntry(EntryIndex);
+			return FTextId(FTextKey(Chunk.Storage->Pool + Entry.NamespaceOffset), FTextKey(Chunk.Storage->Pool + Entry.KeyOffset));
+		}
+		return Chunk.Ids[EntryIndex & ChunkMask];
+	}
+	/**
+	 * Hash of the source string the translation at the given position was made for.
+	 */
+	uint32 GetSourceStringHash(int32 EntryIndex) const
+	{
+		const FChunk& Chunk = GetChunk(EntryIndex);
+		return Chunk.Storage.IsValid() ? Chunk.GetStorageEntry(EntryIndex).SourceStringHash : Chunk.SourceStringHashes[EntryIndex & ChunkMask];
+	}
+	/**
+	 * Translated string at the given position.
+	 */
+	FStringView GetTranslation(int32 EntryIndex) const
+	{
+		const FChunk& Chunk = GetChunk(EntryIndex);
+		if (Chunk.Storage.IsValid())
+		{
+			const FTolgeeCultureIndexStorage::FEntry& Entry = Chunk.GetStorageEntry(EntryIndex);
+			return FStringView(Chunk.Storage->Pool + Entry.TranslationOffset, Entry.TranslationLength);
+		}
+		return Chunk.Translations[EntryIndex & ChunkMask];
+	}
+	/**
+	 * Returns the position of the given id in the index or INDEX_NONE if it's not translated.
+	 */
+	int32 Find(const FTextId& Id) const;
+	/**
+	 * Number of chunks the entries are split into, each holding ChunkSize consecutive entries (the last one possibly less).
+	 */
+	int32 NumChunks() const { return Chunks.Num(); }
+	/**
+	 * Returns true if the chunk is shared with the other index, which means both hold the same entries at the same positions.
+	 */
+	bool SharesChunk(const FTolgeeCultureIndex& Other, int32 ChunkIndex) const { return Chunks.IsValidIndex(ChunkIndex) && Other.Chunks.IsValidIndex(ChunkIndex) && Chunks[ChunkIndex] == Other.Chunks[ChunkIndex]; }
+
+private:
+	friend class FTolgeeCultureIndexBuilder;
+
+	/**
+	 * Parallel arrays holding up to ChunkSize consecutive entries.
+	 */
+	struct FChunk
+	{
+		TArray<FTextId> Ids;
+		TArray<uint32> SourceStringHashes;
+		TArray<FString> Translations;
+		/**
+		 * Entries read in place instead of the arrays above, until the chunk is modified.
+		 */
+		TSharedPtr<const FTolgeeCultureIndexStorage, ESPMode::ThreadSafe> Storage;
+		int32 StorageStart = 0;
+		int32 StorageNum = 0;
+
+		const FTolgeeCultureIndexStorage::FEntry& GetStorageEntry(int32 EntryIndex) const { return Storage->Entries[StorageStart + (EntryIndex & ChunkMask)]; }
+	};
+
+	/**
+	 * Maps the ids of one bucket to their position in the index.
+	 */
+	using FLookupBucket = TMap<FTextId, int32>;
+
+	const FChunk& GetChunk(int32 EntryIndex) const { return *Chunks[EntryIndex >> ChunkShift]; }
+	/**
+	 * Finds the id in the part of the storage lookup that belongs to the bucket.
+	 */
+	int32 FindInStorage(const FTextId& Id, uint32 IdHash, int32 BucketIndex) const;
+
+	TArray<TSharedRef<FChunk, ESPMode::ThreadSafe>> Chunks;
+	/**
+	 * Lookup split by id hash, so patching a few entries only copies the buckets they belong to.
+	 * Unallocated buckets are empty, or read from the storage lookup if the index was created from one.
+	 */
+	TArray<TSharedPtr<FLookupBucket, ESPMode::ThreadSafe>> LookupBuckets;
+	/**
+	 * Storage the index was created from, its lookup answers for the buckets that were not modified since.
+	 */
+	TSharedPtr<const FTolgeeCultureIndexStorage, ESPMode::ThreadSafe> Storage;
+	int32 NumEntries = 0;
+};
+
+/**
+ * Accumulates translations for a single culture and freezes them into an immutable FTolgeeCultureIndex.
+ */
+class TOLGEE_API FTolgeeCultureIndexBuilder
+{
+public:
+	FTolgeeCultureIndexBuilder();
+	/**
+	 * Starts from the translations of an existing index without copying them.
+	 * Only the chunks touched afterwards are copied, the others stay shared between both indices.
+	 */
+	explicit FTolgeeCultureIndexBuilder(const FTolgeeCultureIndexRef& Base);
+
+	/**
+	 * Pre-allocates space for the given number of translations.
+	 */
+	void Reserve(int32 Num);
+	/**
+	 * Adds a translation to the index. If the text was already added, the new translation replaces the old one.
+	 */
+	void Add(const FString& Namespace, const FString& Key, const FString& SourceString, FString Translation);
+	/**
+	 * Adds or replaces a single entry with an already built identity and source string hash.
+	 */
+	void Add(const FTextId& Id, uint32 SourceStringHash, FString Translation);
+	/**
+	 * Removes the translation of the given text if it was added.
+	 */
+	void Remove(const FTextId& Id);
+	/**
+	 * Adds all the translations of an existing index, replacing the ones already added.
+	 */
+	void Append(const FTolgeeCultureIndex& Other);
+	/**
+	 * Number of translations added so far.
+	 */
+	int32 Num() const;
+	/**
+	 * Freezes the added translations into an immutable index. The builder is empty afterwards.
+	 */
+	FTolgeeCultureIndexRef Build();
+
+private:
+	/**
+	 * Returns the chunk for writing, copying it first if it's shared with another index or reads from a storage.
+	 */
+	FTolgeeCultureIndex::FChunk& GetMutableChunk(int32 ChunkIndex);
+	/**
+	 * Returns the lookup bucket of the id for writing, copying it first if it's shared with another index or reads from a storage.
+	 */
+	FTolgeeCultureIndex::FLookupBucket& GetMutableLookupBucket(const FTextId& Id);
+
+	TSharedRef<FTolgeeCultureIndex, ESPMode::ThreadSafe> Index;
+	/**
+	 * Number of entries requested by Reserve, used to size the new chunks.
+	 */
+	int32 ReservedNum = 0;
+};
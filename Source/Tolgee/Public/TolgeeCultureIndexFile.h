@@ -0,0 +1,27 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Misc/Optional.h>
+
+#include "TolgeeCultureIndex.h"
+
+/**
+ * Compact binary form of a FTolgeeCultureIndex, so cached translations are available at boot without parsing PO text.
+ * Layout: a fixed header (magic, version, TCHAR size, engine version, entry count, pool size, SHA1 of the source content), a table of fixed size entries
+ * (namespace, key and translation as offset/length pairs into the string pool plus the source string hash), the lookup (id hashes and positions sorted
+ * by lookup bucket, preceded by the start of every bucket) and a pool of null terminated TCHAR strings.
+ * Files are memory mapped when loading and the loaded index reads from the mapping for as long as it lives.
+ * They are written for the TCHAR size and engine version that wrote them, others simply reject them.
+ */
+namespace TolgeeCultureIndexFile
+{
+	/**
+	 * @brief Serializes the index, tagged with the SHA1 (hex) of the content it was built from
+	 */
+	bool TOLGEE_API Save(const FString& Path, const FTolgeeCultureIndex& Index, const FString& ContentHash);
+	/**
+	 * @brief Loads an index written by Save without copying its entries. Fails if the file is missing, corrupted or was built from different content than ExpectedContentHash (if not empty).
+	 */
+	TOptional<FTolgeeCultureIndexRef> TOLGEE_API Load(const FString& Path, const FString& ExpectedContentHash);
+} // namespace TolgeeCultureIndexFile
@@ -0,0 +1,41 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Misc/Optional.h>
+
+#include "TolgeeCultureIndex.h"
+
+/**
+ * Translations of a single culture coming from multiple ordered sources (layers), e.g. a base game project and its DLC projects.
+ * Later layers override earlier ones, and the merged index is patched with the changed entries whenever a layer changes.
+ */
+class TOLGEE_API FTolgeeLayeredCultureIndex
+{
+public:
+	FTolgeeLayeredCultureIndex();
+
+	/**
+	 * Replaces the translations of a layer and patches the merged index with the entries that changed.
+	 */
+	void SetLayer(int32 Layer, const FTolgeeCultureIndexRef& Translations);
+	/**
+	 * Deduplicated translations of all layers, where every text uses the translation of the last layer containing it.
+	 */
+	const FTolgeeCultureIndexRef& GetMerged() const { return Merged; }
+
+private:
+	/**
+	 * Returns true if a layer after the given one translates the text.
+	 */
+	bool IsOverridden(const FTextId& Id, int32 Layer) const;
+
+	/**
+	 * Translations of every layer, unset for layers that didn't provide data yet.
+	 */
+	TArray<TOptional<FTolgeeCultureIndexRef>> Layers;
+	/**
+	 * Result of merging all the layers.
+	 */
+	FTolgeeCultureIndexRef Merged;
+};
@@ -4,22 +4,13 @@
 
 #include <Subsystems/EngineSubsystem.h>
 
+#include "TolgeeTranslationSnapshot.h"
+
 #include "TolgeeLocalizationInjectorSubsystem.generated.h"
 
 class UGameInstance;
 class FTolgeeTextSource;
 
-/**
- * Holds the parsed data from the PO file
- */
-struct FTolgeeTranslationData
-{
-	FString ParsedNamespace;
-	FString ParsedKey;
-	FString SourceText;
-	FString Translation;
-};
-
 /**
  * Base class for all subsystems responsible for dynamically injecting data at runtime (e.g.: CDN, Dashboard, etc.)
  */
@@ -28,6 +19,13 @@ class TOLGEE_API UTolgeeLocalizationInjectorSubsystem : public UEngineSubsystem
 {
 	GENERATED_BODY()
 
+public:
+	/**
+	 * Overrides every entry of the resource the culture translates and returns how many were injected.
+	 * The source string hash of every overridden entry is stored in OutLiveSourceStringHashes.
+	 */
+	static int32 InjectCulture(const FTolgeeCultureIndex& CultureIndex, FTextLocalizationResource& InOutLocalizedResource, TMap<FTextId, uint32>& OutLiveSourceStringHashes);
+
 protected:
 	/**
 	 * Callback executed when the game instance is created and started.
@@ -42,25 +40,62 @@ protected:
 	 */
 	virtual void GetLocalizedResources(const ELocalizationLoadFlags InLoadFlags, TArrayView<const FString> InPrioritizedCultures, FTextLocalizationResource& InOutNativeResource, FTextLocalizationResource& InOutLocalizedResource) const;
 	/**
-	 * Simplified getter to allow subclasses to provide their own data to inject for GetLocalizedResources.
+	 * Returns the latest snapshot published by the subclass. Safe to call from the refresh thread.
+	 */
+	FTolgeeTranslationSnapshotPtr GetDataToInject() const;
+	/**
+	 * Replaces the data used by GetLocalizedResources with an immutable snapshot of the given cultures. Must be called from the game thread.
+	 */
+	void PublishTranslations(const TMap<FString, FTolgeeCultureIndexRef>& Cultures);
+	/**
+	 * Requests an async refresh of the LocalizationManager resources through the FTolgeeRefreshScheduler shared by all subsystems. Must be called from the game thread.
 	 */
-	virtual TMap<FString, TArray<FTolgeeTranslationData>> GetDataToInject() const;
+	void QueueRefresh();
 	/**
-	 * Triggers an async refresh of the LocalizationManager resources.
+	 * Returns true if the culture is used by the current language (the language itself or one of its fallbacks).
 	 */
-	void RefreshTranslationDataAsync();
+	static bool IsActiveCulture(const FString& Culture);
 	/**
-	 * Converts PO content to a list of translation data.
+	 * Converts UTF-8 PO content to an index of translations ready to be injected. Safe to call from any thread.
 	 */
-	TArray<FTolgeeTranslationData> ExtractTranslationsFromPO(const FString& PoContent);
+	static FTolgeeCultureIndexRef ExtractTranslationsFromPO(TConstArrayView<uint8> PoContent);
 
 	// Begin UEngineSubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 	// End UEngineSubsystem interface
 
 private:
+	friend class FTolgeeRefreshScheduler;
+
 	/**
 	 * Custom Localization Text Source that allows handling of Localized Resources via delegate
 	 */
 	TSharedPtr<FTolgeeTextSource> TextSource;
+	/**
+	 * Holds the snapshot read by the TextSource while the fetchers keep publishing new ones.
+	 */
+	FTolgeeSnapshotPublisher SnapshotPublisher;
+	/**
+	 * Patches the entries that changed between the last injected snapshot and the current one into the live localization data.
+	 * Only the chunks the indices don't share are compared, so the result matches a full refresh without visiting every entry.
+	 * Returns false if a full refresh of the resources is required instead (no previous injection, different active cultures, removed entries or new entries nothing was injected for yet).
+	 */
+	bool TryRefreshTranslationDataDelta();
+	/**
+	 * Guards the bookkeeping of the last injection, shared between the full and the delta refresh.
+	 */
+	mutable FCriticalSection InjectionCriticalSection;
+	/**
+	 * Snapshot used by the last full or delta injection.
+	 */
+	mutable FTolgeeTranslationSnapshotPtr LastInjectedSnapshot;
+	/**
+	 * Prioritized cultures used by the last full injection.
+	 */
+	mutable TArray<FString> LastInjectedCultures;
+	/**
+	 * Source string hashes of the live entries we injected, reused when patching them later.
+	 */
+	mutable TMap<FTextId, uint32> LiveSourceStringHashes;
 };
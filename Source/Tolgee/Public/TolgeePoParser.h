@@ -0,0 +1,17 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/ArrayView.h>
+
+class FTolgeeCultureIndexBuilder;
+
+namespace TolgeePoParser
+{
+	/**
+	 * @brief Parses UTF-8 encoded PO content in a single pass and adds every translated entry straight to the builder.
+	 * Supports msgctxt/msgid/msgstr, escape sequences and multi-line strings without depending on the Localization module.
+	 * Returns false if the content is malformed, entries parsed before the error are still added.
+	 */
+	bool TOLGEE_API ParseIntoIndex(TConstArrayView<uint8> Utf8Content, FTolgeeCultureIndexBuilder& OutBuilder);
+} // namespace TolgeePoParser
@@ -0,0 +1,33 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <CoreTypes.h>
+
+/**
+ * Byte scanning kernels used by the PO parser.
+ * Each function processes 16 (SSE2, NEON) or 32 (AVX2) bytes per step depending on the target and falls back to scalar code for the tail.
+ */
+namespace TolgeePoScanner
+{
+	/**
+	 * @brief Returns the first quote, backslash or line feed in [Begin, End), or End if there is none.
+	 */
+	const uint8* TOLGEE_API FindStringDelimiter(const uint8* Begin, const uint8* End);
+	/**
+	 * @brief Returns the first byte that is not 7-bit ASCII in [Begin, End), or End if there is none.
+	 */
+	const uint8* TOLGEE_API FindNonAscii(const uint8* Begin, const uint8* End);
+	/**
+	 * @brief Returns true if [Begin, End) is well-formed UTF-8 (no overlong encodings, surrogates or code points above U+10FFFF).
+	 */
+	bool TOLGEE_API IsValidUtf8(const uint8* Begin, const uint8* End);
+	/**
+	 * @brief Widens 7-bit ASCII bytes into TCHARs.
+	 */
+	void TOLGEE_API WidenAscii(const uint8* Source, int32 Num, TCHAR* Dest);
+	/**
+	 * @brief Name of the kernel selected for this build (AVX2, SSE2, NEON or Scalar).
+	 */
+	const TCHAR* TOLGEE_API GetKernelName();
+} // namespace TolgeePoScanner
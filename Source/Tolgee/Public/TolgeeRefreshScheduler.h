@@ -0,0 +1,80 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Ticker.h>
+#include <Tasks/Pipe.h>
+#include <Templates/Atomic.h>
+#include <UObject/WeakObjectPtrTemplates.h>
+
+class UTolgeeLocalizationInjectorSubsystem;
+
+/**
+ * Engine-wide scheduler of the localization resource refreshes requested by the injector subsystems.
+ * Requests from every subsystem collapse into a single refresh, refreshes are spaced by at least MinRefreshInterval and run one at a time on a worker.
+ * A refresh patches the entries that changed in every subsystem, or reloads all the resources once if any of them can't be patched.
+ */
+class TOLGEE_API FTolgeeRefreshScheduler
+{
+public:
+	/**
+	 * Returns the scheduler shared by all the subsystems.
+	 */
+	static FTolgeeRefreshScheduler& Get();
+
+	/**
+	 * Includes the subsystem in every future refresh. Must be called from the game thread.
+	 */
+	void Register(UTolgeeLocalizationInjectorSubsystem* Subsystem);
+	/**
+	 * Excludes the subsystem from the refreshes not started yet. Must be called from the game thread.
+	 */
+	void Unregister(UTolgeeLocalizationInjectorSubsystem* Subsystem);
+	/**
+	 * Requests an async refresh of the LocalizationManager resources. Must be called from the game thread.
+	 * Requests made while a refresh is queued collapse into it, the ones made while a refresh executes start a new one once the interval elapsed.
+	 */
+	void QueueRefresh();
+	/**
+	 * Returns true if no refresh is queued or running. Must be called from the game thread.
+	 */
+	bool IsIdle() const;
+
+private:
+	FTolgeeRefreshScheduler();
+
+	/**
+	 * Starts the refresh requested by QueueRefresh.
+	 */
+	bool OnQueuedRefreshTick(float DeltaTime);
+	/**
+	 * Refreshes the subsystems on the worker, unless a newer refresh was started in the meantime.
+	 */
+	void ExecuteRefresh(uint32 RefreshGeneration, const TArray<TWeakObjectPtr<UTolgeeLocalizationInjectorSubsystem>>& RefreshedSubsystems);
+
+	/**
+	 * Subsystems whose translations are refreshed.
+	 */
+	TArray<TWeakObjectPtr<UTolgeeLocalizationInjectorSubsystem>> Subsystems;
+	/**
+	 * Ticker starting the queued refresh, valid while a refresh is queued.
+	 */
+	FTSTicker::FDelegateHandle QueuedRefreshHandle;
+	/**
+	 * Generation of the latest refresh started. Refreshes still waiting for the previous one when a newer one starts are skipped,
+	 * since the newer one picks up the latest snapshots anyway.
+	 */
+	TAtomic<uint32> Generation;
+	/**
+	 * Number of refreshes started that didn't finish or get skipped yet.
+	 */
+	TAtomic<int32> NumPendingRefreshes;
+	/**
+	 * Time (FPlatformTime::Seconds) at which the last refresh started, used to space them out.
+	 */
+	double LastRefreshTime = 0.0;
+	/**
+	 * Runs the refreshes one after the other, without blocking a worker while the previous one executes.
+	 */
+	UE::Tasks::FPipe RefreshPipe;
+};
@@ -6,6 +6,27 @@
 
 #include "TolgeeRuntimeSettings.generated.h"
 
+/**
+ * @brief Controls which cultures are downloaded from the CDN and when.
+ */
+UENUM()
+enum class ETolgeeCdnFetchPolicy : uint8
+{
+	/**
+	 * Downloads every localized culture at startup.
+	 */
+	AllCultures,
+	/**
+	 * Downloads the active culture and its fallbacks first, the remaining cultures are prefetched once those are injected.
+	 * NOTE: The prefetch downloads one culture at a time while no other request is in flight and stops while the application is in the background.
+	 */
+	ActiveCulturesFirst,
+	/**
+	 * Downloads only the active culture and its fallbacks, other cultures are downloaded when the culture changes.
+	 */
+	ActiveCulturesOnly,
+};
+
 /**
  * @brief Settings for the Tolgee runtime functionality.
  * NOTE: Settings here will be packaged in the final game
@@ -28,6 +49,87 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN")
 	bool bUseCdnInEditor = false;
 
+	/**
+	 * Which cultures should be downloaded from the CDN and when.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN")
+	ETolgeeCdnFetchPolicy FetchPolicy = ETolgeeCdnFetchPolicy::ActiveCulturesFirst;
+
+	/**
+	 * If enabled, the CDN files are downloaded as <Culture>.po.gz objects instead of plain <Culture>.po.
+	 * NOTE: Use it when the CDN stores gzip compressed files without serving them with Content-Encoding.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN")
+	bool bUsePrecompressedFiles = false;
+
+	/**
+	 * If enabled, the CDN addresses are treated as mirrors of the same data instead of independent sources.
+	 * Each file is requested from the fastest known mirror and hedged to the next one if it takes longer than usual.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN")
+	bool bCdnAddressesAreMirrors = false;
+
+	/**
+	 * If enabled, a manifest is downloaded from every CDN address first and only the files whose content changed are downloaded.
+	 * The manifest is a JSON file of the form { "files": { "<Culture>": { "hash": "<SHA1 of the uncompressed PO file>", "size": <bytes> } } }.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN")
+	bool bUseManifest = false;
+
+	/**
+	 * Name of the manifest file, relative to each CDN address.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN", meta = (EditCondition = "bUseManifest"))
+	FString ManifestFileName = TEXT("manifest.json");
+
+	/**
+	 * Fraction of past requests a mirror has to beat before the request is hedged to the next mirror (e.g. 0.95 means the 95th percentile latency).
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN", meta = (EditCondition = "bCdnAddressesAreMirrors", ClampMin = "0.5", ClampMax = "1.0"))
+	float HedgeLatencyPercentile = 0.95f;
+
+	/**
+	 * Delay (in seconds) before hedging to the next mirror when there are no latency statistics for the mirror yet.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN", meta = (EditCondition = "bCdnAddressesAreMirrors", ClampMin = "0.0"))
+	float DefaultHedgeDelay = 1.0f;
+
+	/**
+	 * If enabled, the CDN is polled periodically with conditional requests so long sessions pick up hotfixed translations.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN Polling")
+	bool bEnablePolling = false;
+
+	/**
+	 * Delay (in seconds) between two polls while the CDN data keeps changing.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN Polling", meta = (EditCondition = "bEnablePolling", ClampMin = "10.0"))
+	float PollingInterval = 300.0f;
+
+	/**
+	 * Upper limit (in seconds) for the delay between two polls after backing off.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN Polling", meta = (EditCondition = "bEnablePolling", ClampMin = "10.0"))
+	float MaxPollingInterval = 3600.0f;
+
+	/**
+	 * Multiplier applied to the delay every time a poll brings no new data or fails.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN Polling", meta = (EditCondition = "bEnablePolling", ClampMin = "1.0"))
+	float PollingBackoffMultiplier = 2.0f;
+
+	/**
+	 * Random deviation applied to every delay as a fraction of it (e.g. 0.2 means +-20%), so clients don't hit the CDN at the same time.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|CDN Polling", meta = (EditCondition = "bEnablePolling", ClampMin = "0.0", ClampMax = "1.0"))
+	float PollingJitter = 0.2f;
+
+	/**
+	 * Minimum time in seconds between two refreshes of the localization resources. Requests arriving sooner, from any subsystem, are collapsed into a single follow-up refresh.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|Injection", meta = (ClampMin = "0.0"))
+	float MinRefreshInterval = 0.5f;
+
 	// ~ Begin UDeveloperSettings Interface
 	virtual FName GetCategoryName() const override;
 	// ~ End UDeveloperSettings Interface
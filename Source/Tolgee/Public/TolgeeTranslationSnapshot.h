@@ -0,0 +1,60 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <HAL/CriticalSection.h>
+#include <Templates/Atomic.h>
+#include <Templates/SharedPointer.h>
+
+#include "TolgeeCultureIndex.h"
+
+/**
+ * Immutable view of all the translations a subsystem wants to inject, keyed by culture.
+ * Cultures are shared between snapshots, so unchanged cultures are never copied.
+ * Once published, a snapshot is never modified, so it can be read from any thread without copying or locking.
+ */
+struct FTolgeeTranslationSnapshot
+{
+	TMap<FString, FTolgeeCultureIndexRef> Cultures;
+};
+
+using FTolgeeTranslationSnapshotPtr = TSharedPtr<const FTolgeeTranslationSnapshot, ESPMode::ThreadSafe>;
+
+/**
+ * Publishes translation snapshots to readers running on other threads (RCU style).
+ * Readers never take a lock: they only copy the shared pointer of the latest snapshot.
+ * Writers swap the pointer and only wait for readers that are in the middle of copying the slot being reused.
+ */
+class TOLGEE_API FTolgeeSnapshotPublisher
+{
+public:
+	FTolgeeSnapshotPublisher();
+
+	/**
+	 * Makes the snapshot visible to every future call of Acquire.
+	 */
+	void Publish(FTolgeeTranslationSnapshotPtr NewSnapshot);
+	/**
+	 * Returns the latest published snapshot. Safe to call from any thread.
+	 */
+	FTolgeeTranslationSnapshotPtr Acquire() const;
+
+private:
+	/**
+	 * Double buffered storage for the published snapshots. Only the slot at CurrentSlot is read.
+	 */
+	FTolgeeTranslationSnapshotPtr Slots[2];
+	/**
+	 * Number of readers currently copying the pointer stored in each slot.
+	 */
+	mutable TAtomic<int32> NumReaders[2];
+	/**
+	 * Index of the slot holding the latest published snapshot.
+	 */
+	TAtomic<int32> CurrentSlot;
+	/**
+	 * Serializes the writers, readers never touch it.
+	 */
+	FCriticalSection PublishCriticalSection;
+};
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include <Async/Future.h>
 #include <Interfaces/IHttpRequest.h>
+#include <Misc/ScopeLock.h>
 
 namespace TolgeeUtils
 {
@@ -22,4 +24,133 @@ namespace TolgeeUtils
 	 * Adds the Tolgee SDK type and version to the headers of the request
 	 */
 	void TOLGEE_API AddSdkHeaders(FHttpRequestRef& HttpRequest);
+	/**
+	 * @brief Checks if the content starts with the gzip magic bytes
+	 */
+	bool TOLGEE_API IsGzipCompressed(TConstArrayView<uint8> Content);
+	/**
+	 * @brief Decompresses a gzip member, the output size is taken from the gzip trailer
+	 */
+	bool TOLGEE_API DecompressGzip(TConstArrayView<uint8> Content, TArray<uint8>& OutContent);
+	/**
+	 * @brief Points OutContent to the content itself, or to its decompressed copy stored in Buffer if it's gzip compressed
+	 * Some HTTP backends decode the Content-Encoding transparently, so checking the gzip header covers both cases as well as precompressed files.
+	 * Returns false if the compressed content is corrupted.
+	 */
+	bool TOLGEE_API DecodeContent(TConstArrayView<uint8> Content, TArray<uint8>& Buffer, TConstArrayView<uint8>& OutContent);
+	/**
+	 * @brief Creates a GET request for a CDN file which negotiates a gzip compressed transfer
+	 */
+	FHttpRequestRef TOLGEE_API CreateCdnRequest(const FString& Url);
+	/**
+	 * @brief Sends the request and returns a future fulfilled with the response once it completes (null if the request failed)
+	 * The future is fulfilled from the request completion delegate (game thread by default), so continuations attached with Next/Then run there without blocking any worker.
+	 */
+	TFuture<FHttpResponsePtr> TOLGEE_API ProcessRequestAsync(FHttpRequestRef HttpRequest);
+	/**
+	 * @brief Returns a future fulfilled with the results of all the futures, in the same order, once every one of them completed
+	 */
+	template <typename ResultType>
+	TFuture<TArray<ResultType>> WhenAll(TArray<TFuture<ResultType>> Futures);
+	/**
+	 * @brief Returns a future fulfilled with the index of the first future to complete with a result accepted by the predicate
+	 * The future is fulfilled with INDEX_NONE once every future completed without an accepted result.
+	 */
+	template <typename ResultType>
+	TFuture<int32> WhenAny(TArray<TFuture<ResultType>> Futures, TFunction<bool(const ResultType&)> Predicate);
 } // namespace TolgeeUtils
+
+template <typename ResultType>
+TFuture<TArray<ResultType>> TolgeeUtils::WhenAll(TArray<TFuture<ResultType>> Futures)
+{
+	if (Futures.IsEmpty())
+	{
+		return MakeFulfilledPromise<TArray<ResultType>>().GetFuture();
+	}
+
+	struct FState
+	{
+		TPromise<TArray<ResultType>> Promise;
+		TArray<ResultType> Results;
+		int32 NumRemaining = 0;
+		FCriticalSection CriticalSection;
+	};
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+	State->Results.SetNum(Futures.Num());
+	State->NumRemaining = Futures.Num();
+	TFuture<TArray<ResultType>> Result = State->Promise.GetFuture();
+
+	for (int32 FutureIndex = 0; FutureIndex < Futures.Num(); ++FutureIndex)
+	{
+		Futures[FutureIndex].Next([State, FutureIndex](ResultType Value)
+		{
+			bool bCompleted = false;
+			{
+				FScopeLock Lock(&State->CriticalSection);
+				State->Results[FutureIndex] = MoveTemp(Value);
+				bCompleted = --State->NumRemaining == 0;
+			}
+
+			// NOTE: The promise is fulfilled outside the lock, continuations attached to it run synchronously.
+			if (bCompleted)
+			{
+				State->Promise.SetValue(MoveTemp(State->Results));
+			}
+		});
+	}
+
+	return Result;
+}
+
+template <typename ResultType>
+TFuture<int32> TolgeeUtils::WhenAny(TArray<TFuture<ResultType>> Futures, TFunction<bool(const ResultType&)> Predicate)
+{
+	if (Futures.IsEmpty())
+	{
+		return MakeFulfilledPromise<int32>(INDEX_NONE).GetFuture();
+	}
+
+	struct FState
+	{
+		TPromise<int32> Promise;
+		TFunction<bool(const ResultType&)> Predicate;
+		int32 NumRemaining = 0;
+		bool bFulfilled = false;
+		FCriticalSection CriticalSection;
+	};
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+	State->Predicate = MoveTemp(Predicate);
+	State->NumRemaining = Futures.Num();
+	TFuture<int32> Result = State->Promise.GetFuture();
+
+	for (int32 FutureIndex = 0; FutureIndex < Futures.Num(); ++FutureIndex)
+	{
+		Futures[FutureIndex].Next([State, FutureIndex](ResultType Value)
+		{
+			const bool bAccepted = !State->Predicate || State->Predicate(Value);
+
+			int32 FulfilledIndex = INDEX_NONE;
+			bool bShouldFulfill = false;
+			{
+				FScopeLock Lock(&State->CriticalSection);
+				--State->NumRemaining;
+				if (!State->bFulfilled && (bAccepted || State->NumRemaining == 0))
+				{
+					State->bFulfilled = true;
+					bShouldFulfill = true;
+					FulfilledIndex = bAccepted ? FutureIndex : INDEX_NONE;
+				}
+			}
+
+			// NOTE: The promise is fulfilled outside the lock, continuations attached to it run synchronously.
+			if (bShouldFulfill)
+			{
+				State->Promise.SetValue(FulfilledIndex);
+			}
+		});
+	}
+
+	return Result;
+}
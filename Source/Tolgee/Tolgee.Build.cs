@@ -24,16 +24,5 @@ public class Tolgee : ModuleRules
 		{
 			PublicDependencyModuleNames.Add("UnrealEd");
 		}
-
-		bool bLocalizationModuleAvailable = !Target.bIsEngineInstalled || Target.Configuration != UnrealTargetConfiguration.Shipping;
-		if (bLocalizationModuleAvailable)
-		{
-			PublicDefinitions.Add("WITH_LOCALIZATION_MODULE=1");
-			PublicDependencyModuleNames.Add("Localization");
-		}
-		else
-		{
-			PublicDefinitions.Add("WITH_LOCALIZATION_MODULE=0");
-		}
 	}
 }
@@ -129,24 +129,27 @@ void STolgeeTranslationTab::DebugDrawCallback(UCanvas* Canvas, APlayerController
 }
 
 void STolgeeTranslationTab::ShowWidgetForAsync(const FString& TolgeeKeyId)
-{
-	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask,
-	          [this, TolgeeKeyId]()
-	          {
-		          ShowWidgetFor(TolgeeKeyId);
-	          });
-}
-
-void STolgeeTranslationTab::ShowWidgetFor(const FString& TolgeeKeyId)
 {
 	if (bRequestInProgress)
 	{
 		return;
 	}
 
-	TGuardValue ScopedRequestProgress(bRequestInProgress, true);
+	bRequestInProgress = true;
+
+	TWeakPtr<STolgeeTranslationTab> WeakThis = StaticCastSharedRef<STolgeeTranslationTab>(AsShared());
+	FindProjectIdForAsync(TolgeeKeyId).Next([WeakThis, TolgeeKeyId](FString ProjectId)
+	{
+		if (const TSharedPtr<STolgeeTranslationTab> This = WeakThis.Pin())
+		{
+			This->bRequestInProgress = false;
+			This->ShowWidgetFor(TolgeeKeyId, ProjectId);
+		}
+	});
+}
 
-	const FString ProjectId = FindProjectIdFor(TolgeeKeyId);
+void STolgeeTranslationTab::ShowWidgetFor(const FString& TolgeeKeyId, const FString& ProjectId)
+{
 	if (ProjectId.IsEmpty())
 	{
 		UE_LOG(LogTolgee, Warning, TEXT("No project found for key '%s'"), *TolgeeKeyId);
@@ -166,11 +169,12 @@ void STolgeeTranslationTab::ShowWidgetFor(const FString& TolgeeKeyId)
 	}
 }
 
-FString STolgeeTranslationTab::FindProjectIdFor(const FString& TolgeeKeyId) const
+TFuture<FString> STolgeeTranslationTab::FindProjectIdForAsync(const FString& TolgeeKeyId) const
 {
 	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
 
-	TMap<FString, FHttpRequestPtr> PendingRequests;
+	TArray<FString> ProjectIds;
+	TArray<TFuture<FHttpResponsePtr>> PendingResponses;
 	for (const FString& ProjectId : Settings->ProjectIds)
 	{
 		const FString RequestUrl = FString::Printf(TEXT("%s/v2/projects/%s/translations?filterKeyName=%s"), *Settings->GetBaseUrl(), *ProjectId, *TolgeeKeyId);
@@ -181,43 +185,33 @@ FString STolgeeTranslationTab::FindProjectIdFor(const FString& TolgeeKeyId) cons
 		HttpRequest->SetHeader(TEXT("X-API-Key"), Settings->ApiKey);
 		TolgeeUtils::AddSdkHeaders(HttpRequest);
 
-		HttpRequest->ProcessRequest();
-
-		PendingRequests.Add(ProjectId, HttpRequest);
+		ProjectIds.Add(ProjectId);
+		PendingResponses.Add(TolgeeUtils::ProcessRequestAsync(HttpRequest));
 	}
 
-	while (!PendingRequests.IsEmpty())
+	// NOTE: The first project containing the key wins, the remaining responses are ignored.
+	return TolgeeUtils::WhenAny<FHttpResponsePtr>(MoveTemp(PendingResponses), &ContainsKey).Next([ProjectIds](int32 ProjectIndex)
 	{
-		FPlatformProcess::Sleep(0.1f);
+		return ProjectIndex != INDEX_NONE ? ProjectIds[ProjectIndex] : FString();
+	});
+}
 
-		for (auto RequestIt = PendingRequests.CreateIterator(); RequestIt; ++RequestIt)
-		{
-			const TPair<FString, FHttpRequestPtr> Pair = *RequestIt;
-			const FHttpRequestPtr Request = Pair.Value;
-			const FString& ProjectId = Pair.Key;
+bool STolgeeTranslationTab::ContainsKey(const FHttpResponsePtr& Response)
+{
+	const FString ResponseContent = Response.IsValid() ? Response->GetContentAsString() : FString();
 
-			if (EHttpRequestStatus::IsFinished(Request->GetStatus()))
-			{
-				const FHttpResponsePtr Response = Request->GetResponse();
-				const FString ResponseContent = Response.IsValid() ? Response->GetContentAsString() : FString();
-
-				const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseContent);
-				TSharedPtr<FJsonObject> JsonObject;
-
-				if (FJsonSerializer::Deserialize(JsonReader, JsonObject))
-				{
-					const TSharedPtr<FJsonObject> Embedded = JsonObject->GetObjectField(TEXT("_embedded"));
-					const TArray<TSharedPtr<FJsonValue>> Keys = Embedded->GetArrayField(TEXT("keys"));
-					if (!Keys.IsEmpty())
-					{
-						return ProjectId;
-					}
-				}
-
-				RequestIt.RemoveCurrent();
-			}
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseContent);
+	TSharedPtr<FJsonObject> JsonObject;
+
+	if (FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	{
+		const TSharedPtr<FJsonObject>* Embedded = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* Keys = nullptr;
+		if (JsonObject->TryGetObjectField(TEXT("_embedded"), Embedded) && (*Embedded)->TryGetArrayField(TEXT("keys"), Keys))
+		{
+			return !Keys->IsEmpty();
 		}
 	}
 
-	return {};
-}
\ No newline at end of file
+	return false;
+}
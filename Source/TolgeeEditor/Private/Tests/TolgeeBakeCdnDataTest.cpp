@@ -0,0 +1,185 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Async/Async.h>
+#include <Dom/JsonObject.h>
+#include <HAL/FileManager.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Misc/SecureHash.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+
+#include "TolgeeBakeCdnDataCommandlet.h"
+#include "TolgeeCdnCache.h"
+#include "TolgeeCultureIndex.h"
+#include "TolgeeCultureIndexFile.h"
+#include "TolgeeEditorTestUtils.h"
+#include "TolgeePoParser.h"
+#include "TolgeeRuntimeSettings.h"
+
+namespace
+{
+	constexpr int32 NumBakedEntries = 5000;
+
+	/**
+	 * File served by the stand-in CDN for a single culture.
+	 */
+	struct FBakedFile
+	{
+		FString Culture;
+		FString ETag;
+		TArray<uint8> PoContent;
+	};
+
+	/**
+	 * Keeps the commandlet alive while it runs on a worker.
+	 */
+	struct FBakeState
+	{
+		FTolgeeTestServer Server;
+		TTolgeeTestSettingsOverride<UTolgeeRuntimeSettings> Settings;
+		TArray<FBakedFile> Files;
+		FString OutputDirectory;
+		TObjectPtr<UTolgeeBakeCdnDataCommandlet> Commandlet;
+		TFuture<int32> Result;
+		double BakeTime = 0.0;
+
+		FBakeState()
+		{
+			Settings->CdnAddresses = {Server.GetUrl() / TEXT("bake")};
+			Settings->bUsePrecompressedFiles = false;
+			Settings->bCdnAddressesAreMirrors = false;
+		}
+
+		~FBakeState()
+		{
+			if (Commandlet)
+			{
+				Commandlet->RemoveFromRoot();
+			}
+
+			IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+		}
+	};
+
+	TSharedPtr<FJsonObject> LoadJson(const FString& Path)
+	{
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *Path))
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Content), JsonObject);
+		return JsonObject;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeBakeCdnDataTest, "Tolgee.Editor.Cdn.Bake", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeBakeCdnDataTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FBakeState> State = MakeShared<FBakeState>();
+	if (!TestTrue(TEXT("Stand-in CDN started"), State->Server.IsValid()))
+	{
+		return false;
+	}
+
+	State->OutputDirectory = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("TolgeeBake"));
+	IFileManager::Get().DeleteDirectory(*State->OutputDirectory, false, true);
+
+	for (const TCHAR* Culture : {TEXT("de"), TEXT("fr")})
+	{
+		FBakedFile& File = State->Files.AddDefaulted_GetRef();
+		File.Culture = Culture;
+		File.ETag = FString::Printf(TEXT("\"%s-1\""), Culture);
+		File.PoContent = TolgeeEditorTestUtils::MakePoContent(NumBakedEntries, FString::Printf(TEXT("[%s] "), Culture));
+
+		State->Server.AddRoute(FString::Printf(TEXT("/bake/%s.po"), Culture), [&Files = State->Files, FileIndex = State->Files.Num() - 1](const FHttpServerRequest& Request)
+		{
+			const FBakedFile& ServedFile = Files[FileIndex];
+			TUniquePtr<FHttpServerResponse> Response = FTolgeeTestServer::MakeResponse(ServedFile.PoContent, TEXT("text/x-gettext-translation"));
+			Response->Headers.Add(TEXT("ETag"), {ServedFile.ETag});
+			return Response;
+		});
+	}
+
+	// NOTE: The commandlet blocks until every download completes, while the stand-in answers on the game thread, so it runs on a worker.
+	State->Commandlet = NewObject<UTolgeeBakeCdnDataCommandlet>();
+	State->Commandlet->AddToRoot();
+
+	const FString CommandletParams = FString::Printf(TEXT("-cultures=de,fr -output=\"%s\""), *State->OutputDirectory);
+	State->Result = Async(EAsyncExecution::Thread, [State, CommandletParams]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 ReturnCode = State->Commandlet->Main(CommandletParams);
+		State->BakeTime = FPlatformTime::Seconds() - StartTime;
+		return ReturnCode;
+	});
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]() { return State->Result.IsReady(); }, TEXT("the bake commandlet"), 30.0);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		if (!State->Result.IsReady())
+		{
+			return true;
+		}
+
+		TestEqual(TEXT("Commandlet result"), State->Result.Get(), 0);
+
+		for (const FBakedFile& File : State->Files)
+		{
+			const FString Url = TolgeeCdnCache::GetFileUrl(State->Server.GetUrl() / TEXT("bake"), File.Culture);
+			const FString BasePath = State->OutputDirectory / FMD5::HashAnsiString(*Url);
+			const FString ContentHash = TolgeeCdnCache::HashContent(File.PoContent);
+
+			// The validators have to match the response, so the runtime fetcher only revalidates the baked data.
+			const TSharedPtr<FJsonObject> Entry = LoadJson(BasePath + TEXT(".json"));
+			if (!TestTrue(FString::Printf(TEXT("Entry baked for %s"), *File.Culture), Entry.IsValid()))
+			{
+				continue;
+			}
+			TestEqual(TEXT("Baked url"), Entry->GetStringField(TEXT("url")), Url);
+			TestEqual(TEXT("Baked culture"), Entry->GetStringField(TEXT("culture")), File.Culture);
+			TestEqual(TEXT("Baked ETag"), Entry->GetStringField(TEXT("etag")), File.ETag);
+			TestEqual(TEXT("Baked content hash"), Entry->GetStringField(TEXT("hash")), ContentHash);
+
+			const TOptional<FTolgeeCultureIndexRef> Baked = TolgeeCultureIndexFile::Load(BasePath + TEXT(".bin"), ContentHash);
+			if (!TestTrue(FString::Printf(TEXT("Translations baked for %s"), *File.Culture), Baked.IsSet()))
+			{
+				continue;
+			}
+
+			FTolgeeCultureIndexBuilder Builder;
+			TolgeePoParser::ParseIntoIndex(File.PoContent, Builder);
+			const FTolgeeCultureIndexRef Expected = Builder.Build();
+
+			TestEqual(TEXT("Baked entries"), Baked.GetValue()->Num(), Expected->Num());
+			for (int32 EntryIndex = 0; EntryIndex < Expected->Num(); ++EntryIndex)
+			{
+				const int32 BakedIndex = Baked.GetValue()->Find(Expected->GetId(EntryIndex));
+				if (BakedIndex == INDEX_NONE
+					|| !Baked.GetValue()->GetTranslation(BakedIndex).Equals(Expected->GetTranslation(EntryIndex), ESearchCase::CaseSensitive)
+					|| Baked.GetValue()->GetSourceStringHash(BakedIndex) != Expected->GetSourceStringHash(EntryIndex))
+				{
+					AddError(FString::Printf(TEXT("Baked entry %d of %s doesn't match the CDN file."), EntryIndex, *File.Culture));
+					break;
+				}
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("Baked %d cultures of %d entries in %.2f ms."), State->Files.Num(), NumBakedEntries, State->BakeTime * 1000.0));
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
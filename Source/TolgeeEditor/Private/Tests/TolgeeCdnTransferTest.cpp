@@ -0,0 +1,133 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/PlatformTime.h>
+#include <Interfaces/IHttpResponse.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeEditorTestUtils.h"
+#include "TolgeePoParser.h"
+#include "TolgeeUtils.h"
+
+namespace
+{
+	constexpr int32 NumTransferEntries = 20000;
+	constexpr int32 NumDecodeRuns = 5;
+
+	/**
+	 * What the stand-in CDN saw and answered for a single file.
+	 */
+	struct FTransferRecord
+	{
+		FString AcceptEncoding;
+		int32 WireBytes = 0;
+		FHttpResponsePtr Response;
+		bool bCompleted = false;
+	};
+
+	struct FTransferState
+	{
+		FTolgeeTestServer Server;
+		TArray<uint8> PoContent;
+		TArray<uint8> CompressedContent;
+		FTransferRecord Negotiated;
+		FTransferRecord Precompressed;
+	};
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeCdnTransferTest, "Tolgee.Editor.Cdn.CompressedTransfer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeCdnTransferTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FTransferState> State = MakeShared<FTransferState>();
+	if (!TestTrue(TEXT("Stand-in CDN started"), State->Server.IsValid()))
+	{
+		return false;
+	}
+
+	State->PoContent = TolgeeEditorTestUtils::MakePoContent(NumTransferEntries);
+	State->CompressedContent = TolgeeEditorTestUtils::Gzip(State->PoContent);
+
+	FTransferState* const ServedState = &State.Get();
+
+	// Negotiated transfer: plain file, compressed on the fly when the client accepts it.
+	State->Server.AddRoute(TEXT("/cdn/de.po"), [ServedState](const FHttpServerRequest& Request)
+	{
+		ServedState->Negotiated.AcceptEncoding = FTolgeeTestServer::GetHeader(Request, TEXT("Accept-Encoding"));
+		if (!ServedState->Negotiated.AcceptEncoding.Contains(TEXT("gzip")))
+		{
+			ServedState->Negotiated.WireBytes = ServedState->PoContent.Num();
+			return FTolgeeTestServer::MakeResponse(ServedState->PoContent, TEXT("text/x-gettext-translation"));
+		}
+
+		ServedState->Negotiated.WireBytes = ServedState->CompressedContent.Num();
+		TUniquePtr<FHttpServerResponse> Response = FTolgeeTestServer::MakeResponse(ServedState->CompressedContent, TEXT("text/x-gettext-translation"));
+		Response->Headers.Add(TEXT("Content-Encoding"), {TEXT("gzip")});
+		return Response;
+	});
+
+	// Precompressed object: served as an opaque gzip file, without any Content-Encoding.
+	State->Server.AddRoute(TEXT("/cdn/de.po.gz"), [ServedState](const FHttpServerRequest& Request)
+	{
+		ServedState->Precompressed.AcceptEncoding = FTolgeeTestServer::GetHeader(Request, TEXT("Accept-Encoding"));
+		ServedState->Precompressed.WireBytes = ServedState->CompressedContent.Num();
+		return FTolgeeTestServer::MakeResponse(ServedState->CompressedContent, TEXT("application/gzip"));
+	});
+
+	for (FTransferRecord* Record : {&State->Negotiated, &State->Precompressed})
+	{
+		const FString Url = State->Server.GetUrl() + (Record == &State->Negotiated ? TEXT("/cdn/de.po") : TEXT("/cdn/de.po.gz"));
+		TolgeeUtils::ProcessRequestAsync(TolgeeUtils::CreateCdnRequest(Url)).Next([State, Record](FHttpResponsePtr Response)
+		{
+			Record->Response = Response;
+			Record->bCompleted = true;
+		});
+	}
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]() { return State->Negotiated.bCompleted && State->Precompressed.bCompleted; }, TEXT("the CDN responses"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestTrue(TEXT("gzip offered by the request"), State->Negotiated.AcceptEncoding.Contains(TEXT("gzip")));
+		TestTrue(TEXT("Compressed transfer is at least 3 times smaller"), State->Negotiated.WireBytes * 3 < State->PoContent.Num());
+
+		for (const FTransferRecord* Record : {&State->Negotiated, &State->Precompressed})
+		{
+			if (!TestTrue(TEXT("Response received"), Record->Response.IsValid() && EHttpResponseCodes::IsOk(Record->Response->GetResponseCode())))
+			{
+				return true;
+			}
+
+			// Same decoding as the fetcher and the bake commandlet, whether or not the HTTP backend already decoded the body.
+			TArray<uint8> Buffer;
+			TConstArrayView<uint8> Content;
+			TestTrue(TEXT("Response decoded"), TolgeeUtils::DecodeContent(Record->Response->GetContent(), Buffer, Content));
+			TestTrue(TEXT("Decoded content matches the file"), Content.Num() == State->PoContent.Num() && FMemory::Memcmp(Content.GetData(), State->PoContent.GetData(), Content.Num()) == 0);
+
+			FTolgeeCultureIndexBuilder Builder;
+			TestTrue(TEXT("Decoded content parsed"), TolgeePoParser::ParseIntoIndex(Content, Builder));
+			TestEqual(TEXT("Parsed entries"), Builder.Num(), NumTransferEntries);
+		}
+
+		double BestDecodeTime = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < NumDecodeRuns; ++Run)
+		{
+			TArray<uint8> Buffer;
+			TConstArrayView<uint8> Content;
+			const double StartTime = FPlatformTime::Seconds();
+			TolgeeUtils::DecodeContent(State->CompressedContent, Buffer, Content);
+			BestDecodeTime = FMath::Min(BestDecodeTime, FPlatformTime::Seconds() - StartTime);
+		}
+
+		AddInfo(FString::Printf(TEXT("Wire: %d bytes compressed vs %d bytes plain (%.1fx)."), State->Negotiated.WireBytes, State->PoContent.Num(), State->PoContent.Num() / static_cast<double>(FMath::Max(State->Negotiated.WireBytes, 1))));
+		AddInfo(FString::Printf(TEXT("Decode throughput: %.0f MB/s of decompressed content."), State->PoContent.Num() / (1024.0 * 1024.0) / FMath::Max(BestDecodeTime, UE_SMALL_NUMBER)));
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,187 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeEditorCache.h"
+#include "TolgeeEditorIntegrationSubsystem.h"
+#include "TolgeeEditorTestUtils.h"
+
+namespace
+{
+	const TCHAR* DeltaSyncProjectId = TEXT("tolgee-automation-delta-sync");
+	constexpr int32 NumSeededEntries = 5;
+	constexpr int32 DeltaSyncPageSize = 2;
+
+	struct FDeltaSyncState
+	{
+		FTolgeeTestServer Server;
+		FTolgeeTestEditorSubsystem Subsystem{Server.GetUrl(), DeltaSyncProjectId};
+		FDateTime PreviousUpdateTime = FDateTime(2025, 1, 1);
+		FDateTime NewUpdateTime = FDateTime(2025, 1, 1, 1);
+		TArray<FString> ReceivedCursors;
+		TArray<FString> ReceivedRevisedAfter;
+	};
+
+	/**
+	 * Page of the translations listing, keys without a German text have no translation anymore.
+	 */
+	FString MakeListingPage(const TArray<TPair<FString, FString>>& Keys, const FString& NextCursor)
+	{
+		TArray<FString> KeyObjects;
+		for (const TPair<FString, FString>& Key : Keys)
+		{
+			const FString Translations = Key.Value.IsEmpty() ? TEXT("{}") : FString::Printf(TEXT("{\"de\":{\"text\":\"%s\"}}"), *Key.Value);
+			KeyObjects.Add(FString::Printf(TEXT("{\"keyName\":\"%s\",\"translations\":%s}"), *Key.Key, *Translations));
+		}
+
+		// NOTE: Like the real endpoint, empty pages come without the _embedded object.
+		const FString Embedded = KeyObjects.IsEmpty() ? FString() : FString::Printf(TEXT("\"_embedded\":{\"keys\":[%s]},"), *FString::Join(KeyObjects, TEXT(",")));
+		const FString Cursor = NextCursor.IsEmpty() ? FString() : FString::Printf(TEXT(",\"nextCursor\":\"%s\""), *NextCursor);
+		return FString::Printf(TEXT("{%s\"selectedLanguages\":[{\"tag\":\"de\"}]%s}"), *Embedded, *Cursor);
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeEditorDeltaSyncTest, "Tolgee.Editor.Dashboard.DeltaSync", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeEditorDeltaSyncTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FDeltaSyncState> State = MakeShared<FDeltaSyncState>();
+	if (!TestTrue(TEXT("Stand-in dashboard started"), State->Server.IsValid()))
+	{
+		return false;
+	}
+
+	FDeltaSyncState* const ServedState = &State.Get();
+	const FString ProjectPath = FString::Printf(TEXT("/v2/projects/%s"), DeltaSyncProjectId);
+
+	State->Server.AddRoute(ProjectPath + TEXT("/stats"), [ServedState](const FHttpServerRequest& Request)
+	{
+		// German changed since the last sync, English was never seen but is older than the last full fetch.
+		return FTolgeeTestServer::MakeJsonResponse(FString::Printf(
+			TEXT("{\"languageStats\":[{\"languageTag\":\"de\",\"translationsUpdatedAt\":%lld},{\"languageTag\":\"en\",\"translationsUpdatedAt\":%lld}]}"),
+			TolgeeEditorTestUtils::ToUnixMilliseconds(ServedState->NewUpdateTime), TolgeeEditorTestUtils::ToUnixMilliseconds(ServedState->PreviousUpdateTime) - 1000));
+	});
+
+	State->Server.AddRoute(ProjectPath + TEXT("/translations"), [ServedState](const FHttpServerRequest& Request)
+	{
+		const FString Cursor = Request.QueryParams.FindRef(TEXT("cursor"));
+		ServedState->ReceivedCursors.Add(Cursor);
+		ServedState->ReceivedRevisedAfter.Add(Request.QueryParams.FindRef(TEXT("filterRevisedAfter")));
+
+		if (Cursor.IsEmpty())
+		{
+			return FTolgeeTestServer::MakeJsonResponse(MakeListingPage({{TEXT("Namespace,Key1"), TEXT("Neu 1")}, {TEXT("Namespace,Key2"), TEXT("")}}, TEXT("page-2")));
+		}
+		if (Cursor == TEXT("page-2"))
+		{
+			return FTolgeeTestServer::MakeJsonResponse(MakeListingPage({{TEXT("Namespace,Key5"), TEXT("Neu 5")}, {TEXT("Namespace,Key6"), TEXT("Neu 6")}}, TEXT("page-3")));
+		}
+		return FTolgeeTestServer::MakeJsonResponse(MakeListingPage({}, TEXT("")));
+	});
+
+	State->Subsystem.Settings->bUseDeltaSync = true;
+	State->Subsystem.Settings->DeltaSyncPageSize = DeltaSyncPageSize;
+	State->Subsystem.SeedProject(TEXT("de"), NumSeededEntries, TEXT("Alt "), State->PreviousUpdateTime);
+	State->Subsystem->RequestUpdateCheck();
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]() { return !State->Subsystem->bRequestInProgress; }, TEXT("the delta sync"));
+
+	// NOTE: The project is saved in the background once the batch completed, the description is written last.
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]()
+	{
+		FTolgeeEditorProjectCache Project;
+		return TolgeeEditorCache::Load(DeltaSyncProjectId, Project) && Project.LanguageUpdateTimes.FindRef(TEXT("de")) == State->NewUpdateTime;
+	}, TEXT("the project cache"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestEqual(TEXT("Stats requests"), State->Server.GetNumRequests(FString::Printf(TEXT("/v2/projects/%s/stats"), DeltaSyncProjectId)), 1);
+		TestEqual(TEXT("Listing pages requested"), State->ReceivedCursors, TArray<FString>({TEXT(""), TEXT("page-2"), TEXT("page-3")}));
+
+		const FString ExpectedRevisedAfter = LexToString(TolgeeEditorTestUtils::ToUnixMilliseconds(State->PreviousUpdateTime));
+		for (const FString& RevisedAfter : State->ReceivedRevisedAfter)
+		{
+			TestEqual(TEXT("Keys requested since the last sync"), RevisedAfter, ExpectedRevisedAfter);
+		}
+
+		const TMap<FString, FTolgeeCultureIndexRef>* Cultures = State->Subsystem->ProjectTranslations.Find(DeltaSyncProjectId);
+		const FTolgeeCultureIndexRef* German = Cultures ? Cultures->Find(TEXT("de")) : nullptr;
+		if (!TestNotNull(TEXT("German translations"), German))
+		{
+			return true;
+		}
+
+		TestEqual(TEXT("Entries after the delta"), (*German)->Num(), NumSeededEntries - 1 + 2);
+		TestTrue(TEXT("Untouched entry kept"), TolgeeEditorTestUtils::FindTranslation(**German, 0).StartsWith(TEXT("Alt ")));
+		TestEqual(TEXT("Changed entry patched"), TolgeeEditorTestUtils::FindTranslation(**German, 1), FString(TEXT("Neu 1")));
+		TestEqual(TEXT("Entry without translation removed"), TolgeeEditorTestUtils::FindTranslation(**German, 2), FString());
+		TestEqual(TEXT("Entry from the second page added"), TolgeeEditorTestUtils::FindTranslation(**German, 6), FString(TEXT("Neu 6")));
+
+		const TMap<FString, FDateTime>& UpdateTimes = State->Subsystem->LanguageUpdateTimes.FindChecked(DeltaSyncProjectId);
+		TestEqual(TEXT("German update time advanced"), UpdateTimes.FindRef(TEXT("de")), State->NewUpdateTime);
+		TestTrue(TEXT("English update time recorded without a fetch"), UpdateTimes.Contains(TEXT("en")));
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeEditorDeltaSyncSessionsTest, "Tolgee.Editor.Dashboard.DeltaSync.Sessions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeEditorDeltaSyncSessionsTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FDeltaSyncState> State = MakeShared<FDeltaSyncState>();
+	if (!TestTrue(TEXT("Stand-in dashboard started"), State->Server.IsValid()))
+	{
+		return false;
+	}
+
+	FDeltaSyncState* const ServedState = &State.Get();
+	const FString StatsPath = FString::Printf(TEXT("/v2/projects/%s/stats"), DeltaSyncProjectId);
+	const FString ExportPath = FString::Printf(TEXT("/v2/projects/%s/export"), DeltaSyncProjectId);
+
+	State->Server.AddRoute(StatsPath, [ServedState](const FHttpServerRequest& Request)
+	{
+		// Nothing changed since the project was exported, only a full export would request it again.
+		return FTolgeeTestServer::MakeJsonResponse(FString::Printf(TEXT("{\"languageStats\":[{\"languageTag\":\"de\",\"translationsUpdatedAt\":%lld}]}"),
+		                                                         TolgeeEditorTestUtils::ToUnixMilliseconds(ServedState->PreviousUpdateTime)));
+	});
+	State->Server.AddRoute(ExportPath, [](const FHttpServerRequest& Request)
+	{
+		return FTolgeeTestServer::MakeJsonResponse(TEXT("{}"));
+	});
+
+	State->Subsystem.Settings->bUseDeltaSync = true;
+	State->Subsystem.Settings->bUseLiveUpdates = false;
+	State->Subsystem.SeedProject(TEXT("de"), NumSeededEntries, TEXT("Alt "), State->PreviousUpdateTime);
+
+	for (int32 Session = 1; Session <= 2; ++Session)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]()
+		{
+			State->Subsystem->BeginSession();
+			return true;
+		}));
+
+		TolgeeEditorTestUtils::WaitUntil(*this, [State, StatsPath, Session]()
+		{
+			return State->Server.GetNumRequests(StatsPath) == Session && !State->Subsystem->bRequestInProgress;
+		}, FString::Printf(TEXT("the update check of session %d"), Session));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, ExportPath, Session]()
+		{
+			TestEqual(FString::Printf(TEXT("Export requests in session %d"), Session), State->Server.GetNumRequests(ExportPath), 0);
+			TestTrue(FString::Printf(TEXT("Translations injected in session %d"), Session), TolgeeEditorTestUtils::FindTranslation(State->Subsystem->CachedTranslations, TEXT("de"), 1).StartsWith(TEXT("Alt ")));
+
+			State->Subsystem->OnGameInstanceEnd(false);
+			return true;
+		}));
+	}
+
+	return true;
+}
+
+#endif
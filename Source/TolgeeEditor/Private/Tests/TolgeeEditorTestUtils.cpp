@@ -0,0 +1,538 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeEditorTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Common/TcpSocketBuilder.h>
+#include <Containers/StringConv.h>
+#include <HAL/FileManager.h>
+#include <HttpPath.h>
+#include <HttpServerModule.h>
+#include <IHttpRouter.h>
+#include <Interfaces/IPv4/IPv4Endpoint.h>
+#include <Misc/Base64.h>
+#include <Misc/Compression.h>
+#include <Misc/EngineVersionComparison.h>
+#include <Misc/SecureHash.h>
+#include <Sockets.h>
+#include <SocketSubsystem.h>
+#include <UObject/Package.h>
+
+#include "TolgeeEditorCache.h"
+#include "TolgeeEditorIntegrationSubsystem.h"
+#include "TolgeePoParser.h"
+
+FTolgeeTestServer::FTolgeeTestServer()
+{
+	Router = FHttpServerModule::Get().GetHttpRouter(Port, true);
+}
+
+FTolgeeTestServer::~FTolgeeTestServer()
+{
+	if (Router)
+	{
+		for (const FHttpRouteHandle& RouteHandle : RouteHandles)
+		{
+			Router->UnbindRoute(RouteHandle);
+		}
+	}
+}
+
+bool FTolgeeTestServer::IsValid() const
+{
+	return Router.IsValid();
+}
+
+FString FTolgeeTestServer::GetUrl() const
+{
+	return FString::Printf(TEXT("http://localhost:%u"), Port);
+}
+
+void FTolgeeTestServer::AddRoute(const FString& Path, FRouteHandler Handler)
+{
+	if (!Router)
+	{
+		return;
+	}
+
+	const auto ProcessRequest = [this, Path, Handler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		NumRequests.FindOrAdd(Path)++;
+		OnComplete(Handler(Request));
+		return true;
+	};
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	RouteHandles.Add(Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET, ProcessRequest));
+#else
+	RouteHandles.Add(Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET, FHttpRequestHandler::CreateLambda(ProcessRequest)));
+#endif
+
+	// NOTE: Listeners are only created for routers that have routes, starting them again is a no-op for the ones already listening.
+	FHttpServerModule::Get().StartAllListeners();
+}
+
+int32 FTolgeeTestServer::GetNumRequests(const FString& Path) const
+{
+	return NumRequests.FindRef(Path);
+}
+
+FString FTolgeeTestServer::GetHeader(const FHttpServerRequest& Request, const FString& Name)
+{
+	for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+	{
+		if (Header.Key.Equals(Name, ESearchCase::IgnoreCase))
+		{
+			return FString::Join(Header.Value, TEXT(","));
+		}
+	}
+	return FString();
+}
+
+TUniquePtr<FHttpServerResponse> FTolgeeTestServer::MakeResponse(TArray<uint8> Body, const FString& ContentType)
+{
+	return FHttpServerResponse::Create(MoveTemp(Body), ContentType);
+}
+
+TUniquePtr<FHttpServerResponse> FTolgeeTestServer::MakeJsonResponse(const FString& Json)
+{
+	return FHttpServerResponse::Create(Json, TEXT("application/json"));
+}
+
+namespace
+{
+	/**
+	 * Parses the command and headers of a STOMP frame, the body follows the first empty line.
+	 */
+	FString ParseStompFrame(const FString& Frame, TMap<FString, FString>& OutHeaders)
+	{
+		FString Head;
+		FString Body;
+		if (!Frame.TrimStart().Split(TEXT("\n\n"), &Head, &Body))
+		{
+			Head = Frame.TrimStart();
+		}
+
+		TArray<FString> Lines;
+		Head.ParseIntoArrayLines(Lines);
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			FString Name;
+			FString Value;
+			if (Lines[LineIndex].Split(TEXT(":"), &Name, &Value) && !OutHeaders.Contains(Name))
+			{
+				OutHeaders.Add(Name, Value.TrimEnd());
+			}
+		}
+
+		return Lines.IsEmpty() ? FString() : Lines[0].TrimEnd();
+	}
+} // namespace
+
+FTolgeeTestStompServer::FTolgeeTestStompServer()
+{
+	Listener = FTcpSocketBuilder(TEXT("TolgeeTestStompServer"))
+	           .AsNonBlocking()
+	           .AsReusable()
+	           .BoundToEndpoint(FIPv4Endpoint(FIPv4Address::InternalLoopback, Port))
+	           .Listening(1)
+	           .Build();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTolgeeTestStompServer::Tick));
+}
+
+FTolgeeTestStompServer::~FTolgeeTestStompServer()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	CloseClient();
+
+	if (Listener)
+	{
+		Listener->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Listener);
+	}
+}
+
+bool FTolgeeTestStompServer::IsValid() const
+{
+	return Listener != nullptr;
+}
+
+FString FTolgeeTestStompServer::GetUrl() const
+{
+	return FString::Printf(TEXT("ws://127.0.0.1:%u/websocket/websocket"), Port);
+}
+
+const TMap<FString, FString>& FTolgeeTestStompServer::GetConnectHeaders() const
+{
+	return ConnectHeaders;
+}
+
+bool FTolgeeTestStompServer::IsSubscribed(const FString& Destination) const
+{
+	return Subscriptions.Contains(Destination);
+}
+
+bool FTolgeeTestStompServer::SendMessage(const FString& Destination, const FString& Body)
+{
+	const FString* SubscriptionId = Subscriptions.Find(Destination);
+	if (!SubscriptionId)
+	{
+		return false;
+	}
+
+	return SendStompFrame(FString::Printf(TEXT("MESSAGE\ndestination:%s\nsubscription:%s\nmessage-id:%d\ncontent-type:application/json\n\n%s"), *Destination, **SubscriptionId, NextMessageId++, *Body));
+}
+
+bool FTolgeeTestStompServer::Tick(float DeltaTime)
+{
+	if (!Listener)
+	{
+		return true;
+	}
+
+	// NOTE: A new connection replaces the previous one, like a client reconnecting after a drop.
+	bool bHasPendingConnection = false;
+	if (Listener->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+	{
+		if (FSocket* Accepted = Listener->Accept(TEXT("TolgeeTestStompClient")))
+		{
+			CloseClient();
+			Client = Accepted;
+			Client->SetNonBlocking(true);
+		}
+	}
+
+	uint32 PendingDataSize = 0;
+	while (Client && Client->HasPendingData(PendingDataSize) && PendingDataSize > 0)
+	{
+		const int32 Offset = ReceiveBuffer.Num();
+		ReceiveBuffer.AddUninitialized(PendingDataSize);
+
+		int32 BytesRead = 0;
+		Client->Recv(ReceiveBuffer.GetData() + Offset, PendingDataSize, BytesRead);
+		ReceiveBuffer.SetNum(Offset + BytesRead);
+	}
+
+	if (Client && !bUpgraded)
+	{
+		ReadHandshake();
+	}
+	if (Client && bUpgraded)
+	{
+		ReadWebSocketFrames();
+	}
+
+	return true;
+}
+
+void FTolgeeTestStompServer::ReadHandshake()
+{
+	static const uint8 HeaderEnd[] = {'\r', '\n', '\r', '\n'};
+
+	int32 RequestEnd = INDEX_NONE;
+	for (int32 Index = 0; Index + UE_ARRAY_COUNT(HeaderEnd) <= ReceiveBuffer.Num(); ++Index)
+	{
+		if (FMemory::Memcmp(ReceiveBuffer.GetData() + Index, HeaderEnd, UE_ARRAY_COUNT(HeaderEnd)) == 0)
+		{
+			RequestEnd = Index + UE_ARRAY_COUNT(HeaderEnd);
+			break;
+		}
+	}
+
+	if (RequestEnd == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(ReceiveBuffer.GetData()), RequestEnd);
+	const FString Request(Converted.Length(), Converted.Get());
+	ReceiveBuffer.RemoveAt(0, RequestEnd);
+
+	TArray<FString> Lines;
+	Request.ParseIntoArrayLines(Lines);
+
+	FString Key;
+	for (const FString& Line : Lines)
+	{
+		FString Name;
+		FString Value;
+		if (Line.Split(TEXT(":"), &Name, &Value) && Name.TrimEnd().Equals(TEXT("Sec-WebSocket-Key"), ESearchCase::IgnoreCase))
+		{
+			Key = Value.TrimStartAndEnd();
+		}
+	}
+
+	if (Key.IsEmpty())
+	{
+		CloseClient();
+		return;
+	}
+
+	// NOTE: The accept value is the SHA-1 of the key and the GUID from RFC 6455, the STOMP subprotocol the client asks for is confirmed like Tolgee does.
+	const FString AcceptSource = Key + TEXT("258EAFA5-E914-47DA-95CA-C5AB0DC85B11");
+	const FTCHARToUTF8 AcceptSourceUtf8(*AcceptSource);
+	uint8 AcceptHash[FSHA1::DigestSize];
+	FSHA1::HashBuffer(AcceptSourceUtf8.Get(), AcceptSourceUtf8.Length(), AcceptHash);
+
+	const FString Response = FString::Printf(TEXT("HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: %s\r\nSec-WebSocket-Protocol: v12.stomp\r\n\r\n"), *FBase64::Encode(AcceptHash, FSHA1::DigestSize));
+	const FTCHARToUTF8 ResponseUtf8(*Response);
+	bUpgraded = SendBytes(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(ResponseUtf8.Get()), ResponseUtf8.Length()));
+}
+
+void FTolgeeTestStompServer::ReadWebSocketFrames()
+{
+	while (ReceiveBuffer.Num() >= 2)
+	{
+		const uint8 Opcode = ReceiveBuffer[0] & 0x0F;
+		const bool bMasked = (ReceiveBuffer[1] & 0x80) != 0;
+
+		int32 HeaderSize = 2;
+		int64 PayloadSize = ReceiveBuffer[1] & 0x7F;
+		if (PayloadSize == 126 || PayloadSize == 127)
+		{
+			const int32 NumSizeBytes = PayloadSize == 126 ? 2 : 8;
+			if (ReceiveBuffer.Num() < HeaderSize + NumSizeBytes)
+			{
+				return;
+			}
+
+			PayloadSize = 0;
+			for (int32 ByteIndex = 0; ByteIndex < NumSizeBytes; ++ByteIndex)
+			{
+				PayloadSize = (PayloadSize << 8) | ReceiveBuffer[HeaderSize + ByteIndex];
+			}
+			HeaderSize += NumSizeBytes;
+		}
+
+		const int32 MaskOffset = HeaderSize;
+		HeaderSize += bMasked ? 4 : 0;
+		if (ReceiveBuffer.Num() < HeaderSize + PayloadSize)
+		{
+			return;
+		}
+
+		// NOTE: Frames sent by clients are always masked.
+		TArray<uint8> Payload(ReceiveBuffer.GetData() + HeaderSize, static_cast<int32>(PayloadSize));
+		for (int32 ByteIndex = 0; bMasked && ByteIndex < Payload.Num(); ++ByteIndex)
+		{
+			Payload[ByteIndex] ^= ReceiveBuffer[MaskOffset + ByteIndex % 4];
+		}
+		ReceiveBuffer.RemoveAt(0, HeaderSize + static_cast<int32>(PayloadSize));
+
+		if (Opcode == 0x8)
+		{
+			CloseClient();
+			return;
+		}
+
+		// NOTE: Text, binary and continuation frames carry the STOMP stream, control frames (ping, pong) are ignored.
+		if (Opcode <= 0x2)
+		{
+			StompBuffer.Append(Payload);
+		}
+	}
+
+	int32 FrameEnd = INDEX_NONE;
+	while (Client && StompBuffer.Find(0, FrameEnd))
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(StompBuffer.GetData()), FrameEnd);
+		const FString Frame(Converted.Length(), Converted.Get());
+		StompBuffer.RemoveAt(0, FrameEnd + 1);
+
+		HandleStompFrame(Frame);
+	}
+}
+
+void FTolgeeTestStompServer::HandleStompFrame(const FString& Frame)
+{
+	TMap<FString, FString> Headers;
+	const FString Command = ParseStompFrame(Frame, Headers);
+
+	if (Command == TEXT("CONNECT") || Command == TEXT("STOMP"))
+	{
+		ConnectHeaders = MoveTemp(Headers);
+		SendStompFrame(TEXT("CONNECTED\nversion:1.2\nheart-beat:0,0\n\n"));
+	}
+	else if (Command == TEXT("SUBSCRIBE"))
+	{
+		Subscriptions.Add(Headers.FindRef(TEXT("destination")), Headers.FindRef(TEXT("id")));
+	}
+	else if (Command == TEXT("DISCONNECT"))
+	{
+		CloseClient();
+	}
+}
+
+bool FTolgeeTestStompServer::SendStompFrame(const FString& Frame)
+{
+	const FTCHARToUTF8 FrameUtf8(*Frame);
+	const int32 PayloadSize = FrameUtf8.Length() + 1;
+
+	// NOTE: Frames sent by the server are never masked, the STOMP frame is terminated by a null byte.
+	TArray<uint8> Message;
+	Message.Add(0x81);
+	if (PayloadSize < 126)
+	{
+		Message.Add(static_cast<uint8>(PayloadSize));
+	}
+	else if (PayloadSize <= MAX_uint16)
+	{
+		Message.Add(126);
+		Message.Add(static_cast<uint8>(PayloadSize >> 8));
+		Message.Add(static_cast<uint8>(PayloadSize));
+	}
+	else
+	{
+		Message.Add(127);
+		for (int32 ByteIndex = 7; ByteIndex >= 0; --ByteIndex)
+		{
+			Message.Add(static_cast<uint8>(static_cast<uint64>(PayloadSize) >> (ByteIndex * 8)));
+		}
+	}
+	Message.Append(reinterpret_cast<const uint8*>(FrameUtf8.Get()), FrameUtf8.Length());
+	Message.Add(0);
+
+	return SendBytes(Message);
+}
+
+bool FTolgeeTestStompServer::SendBytes(TConstArrayView<uint8> Data)
+{
+	int32 Offset = 0;
+	while (Client && Offset < Data.Num())
+	{
+		int32 BytesSent = 0;
+		if (!Client->Send(Data.GetData() + Offset, Data.Num() - Offset, BytesSent))
+		{
+			return false;
+		}
+		Offset += BytesSent;
+	}
+	return Client != nullptr;
+}
+
+void FTolgeeTestStompServer::CloseClient()
+{
+	if (Client)
+	{
+		Client->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client);
+		Client = nullptr;
+	}
+
+	bUpgraded = false;
+	ReceiveBuffer.Reset();
+	StompBuffer.Reset();
+	ConnectHeaders.Reset();
+	Subscriptions.Reset();
+}
+
+FTolgeeTestEditorSubsystem::FTolgeeTestEditorSubsystem(const FString& ApiUrl, const FString& InProjectId) :
+	ProjectId(InProjectId)
+{
+	Settings->ApiUrl = ApiUrl;
+	Settings->ProjectIds = {ProjectId};
+
+	Subsystem = NewObject<UTolgeeEditorIntegrationSubsystem>(GetTransientPackage());
+	Subsystem->AddToRoot();
+}
+
+FTolgeeTestEditorSubsystem::~FTolgeeTestEditorSubsystem()
+{
+	Subsystem->DisconnectLiveUpdates();
+	Subsystem->ResetData();
+	Subsystem->RemoveFromRoot();
+
+	IFileManager::Get().DeleteDirectory(*(TolgeeEditorCache::GetCacheDirectory() / ProjectId), false, true);
+}
+
+void FTolgeeTestEditorSubsystem::SeedProject(const FString& Culture, int32 NumEntries, const FString& TranslationPrefix, const FDateTime& UpdateTime)
+{
+	FTolgeeCultureIndexBuilder Builder;
+	TolgeePoParser::ParseIntoIndex(TolgeeEditorTestUtils::MakePoContent(NumEntries, TranslationPrefix), Builder);
+
+	Subsystem->ProjectTranslations.FindOrAdd(ProjectId).Add(Culture, Builder.Build());
+	Subsystem->LanguageUpdateTimes.FindOrAdd(ProjectId).Add(Culture, UpdateTime);
+	Subsystem->ProjectFetchTimes.Add(ProjectId, UpdateTime);
+	Subsystem->FullyExportedProjects.Add(ProjectId);
+}
+
+TArray<uint8> TolgeeEditorTestUtils::MakePoContent(int32 NumEntries, const FString& TranslationPrefix)
+{
+	static const TCHAR* Vocabulary[] = {
+		TEXT("Press"), TEXT("to"), TEXT("continue"), TEXT("the"), TEXT("game"), TEXT("settings"), TEXT("player"), TEXT("inventory"),
+		TEXT("quest"), TEXT("completed"), TEXT("new"), TEXT("item"), TEXT("level"), TEXT("up"), TEXT("save"), TEXT("load"),
+		TEXT("options"), TEXT("audio"), TEXT("video"), TEXT("controls"), TEXT("back"), TEXT("exit"), TEXT("confirm"), TEXT("cancel")
+	};
+
+	FString Content = TEXT("msgid \"\"\nmsgstr \"\"\n\"Content-Type: text/plain; charset=UTF-8\\n\"\n\n");
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		FString Translation = TranslationPrefix;
+		for (int32 WordIndex = 0; WordIndex < 6; ++WordIndex)
+		{
+			Translation.Appendf(TEXT("%s "), Vocabulary[(EntryIndex * 7 + WordIndex * 13) % UE_ARRAY_COUNT(Vocabulary)]);
+		}
+
+		Content.Appendf(TEXT("msgctxt \"Namespace,Key%d\"\nmsgid \"Source %d\"\nmsgstr \"%s\"\n\n"), EntryIndex, EntryIndex, *Translation.TrimEnd());
+	}
+
+	const FTCHARToUTF8 Utf8Content(*Content, Content.Len());
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8Content.Get()), Utf8Content.Length());
+}
+
+TArray<uint8> TolgeeEditorTestUtils::Gzip(TConstArrayView<uint8> Content)
+{
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Content.Num());
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Content.GetData(), Content.Num()))
+	{
+		return {};
+	}
+	Compressed.SetNum(CompressedSize);
+	return Compressed;
+}
+
+FString TolgeeEditorTestUtils::FindTranslation(const FTolgeeCultureIndex& Index, int32 EntryIndex)
+{
+	const int32 Position = Index.Find(FTextId(FTextKey(TEXT("Namespace")), FTextKey(FString::Printf(TEXT("Key%d"), EntryIndex))));
+	return Position != INDEX_NONE ? FString(Index.GetTranslation(Position)) : FString();
+}
+
+FString TolgeeEditorTestUtils::FindTranslation(const TMap<FString, FTolgeeCultureIndexRef>& Cultures, const FString& Culture, int32 EntryIndex)
+{
+	const FTolgeeCultureIndexRef* Index = Cultures.Find(Culture);
+	return Index ? FindTranslation(**Index, EntryIndex) : FString();
+}
+
+int64 TolgeeEditorTestUtils::ToUnixMilliseconds(const FDateTime& Time)
+{
+	return static_cast<int64>((Time - FDateTime::FromUnixTimestamp(0)).GetTotalMilliseconds());
+}
+
+void TolgeeEditorTestUtils::WaitUntil(FAutomationTestBase& Test, TFunction<bool()> Predicate, const FString& Description, double Timeout)
+{
+	// NOTE: The timeout starts once the command executes, not when it's queued behind the previous ones.
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([&Test, Predicate = MoveTemp(Predicate), Description, Timeout, StartTime = 0.0]() mutable
+	{
+		if (StartTime == 0.0)
+		{
+			StartTime = FPlatformTime::Seconds();
+		}
+		if (Predicate())
+		{
+			return true;
+		}
+		if (FPlatformTime::Seconds() - StartTime > Timeout)
+		{
+			Test.AddError(FString::Printf(TEXT("Timed out waiting for %s."), *Description));
+			return true;
+		}
+		return false;
+	}));
+}
+
+#endif
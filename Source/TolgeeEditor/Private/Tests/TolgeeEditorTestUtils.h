@@ -0,0 +1,234 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Containers/Ticker.h>
+#include <HttpRouteHandle.h>
+#include <HttpServerRequest.h>
+#include <HttpServerResponse.h>
+#include <Serialization/ObjectReader.h>
+#include <Serialization/ObjectWriter.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeEditorSettings.h"
+
+class FSocket;
+class IHttpRouter;
+class UTolgeeEditorIntegrationSubsystem;
+
+/**
+ * Local stand-in for the CDN and the Tolgee API, serves the routes bound by a test on localhost so the tests run offline.
+ * Routes are unbound when the server is destroyed, the listener itself is shared with the rest of the editor and keeps running.
+ */
+class FTolgeeTestServer
+{
+public:
+	using FRouteHandler = TFunction<TUniquePtr<FHttpServerResponse>(const FHttpServerRequest& Request)>;
+
+	/**
+	 * Port the stand-in listens on.
+	 */
+	static constexpr uint32 Port = 18734;
+
+	FTolgeeTestServer();
+	~FTolgeeTestServer();
+
+	/**
+	 * Returns true if the listener could be created.
+	 */
+	bool IsValid() const;
+	/**
+	 * Base url of the server, without a trailing slash.
+	 */
+	FString GetUrl() const;
+	/**
+	 * Serves GET requests for the path with the handler, executed on the game thread.
+	 */
+	void AddRoute(const FString& Path, FRouteHandler Handler);
+	/**
+	 * Number of requests received for the path.
+	 */
+	int32 GetNumRequests(const FString& Path) const;
+	/**
+	 * Returns the value of the header (case insensitive) or an empty string.
+	 */
+	static FString GetHeader(const FHttpServerRequest& Request, const FString& Name);
+	/**
+	 * Creates a 200 response with the raw body.
+	 */
+	static TUniquePtr<FHttpServerResponse> MakeResponse(TArray<uint8> Body, const FString& ContentType);
+	/**
+	 * Creates a 200 response with a JSON body.
+	 */
+	static TUniquePtr<FHttpServerResponse> MakeJsonResponse(const FString& Json);
+
+private:
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+	TMap<FString, int32> NumRequests;
+};
+
+/**
+ * Local stand-in for the Tolgee STOMP endpoint, accepts a single WebSocket client on localhost and answers the frames the live updates use.
+ * Everything runs on the game thread, ticked by the core ticker.
+ */
+class FTolgeeTestStompServer
+{
+public:
+	/**
+	 * Port the stand-in listens on.
+	 */
+	static constexpr uint32 Port = 18735;
+
+	FTolgeeTestStompServer();
+	~FTolgeeTestStompServer();
+
+	/**
+	 * Returns true if the listener could be created.
+	 */
+	bool IsValid() const;
+	/**
+	 * WebSocket url of the endpoint.
+	 */
+	FString GetUrl() const;
+	/**
+	 * Headers of the CONNECT frame, empty until a client connected.
+	 */
+	const TMap<FString, FString>& GetConnectHeaders() const;
+	/**
+	 * Returns true if the client subscribed to the destination.
+	 */
+	bool IsSubscribed(const FString& Destination) const;
+	/**
+	 * Sends a MESSAGE frame with the body to the client subscribed to the destination.
+	 */
+	bool SendMessage(const FString& Destination, const FString& Body);
+
+private:
+	/**
+	 * Accepts the client, completes the WebSocket handshake and handles the frames received.
+	 */
+	bool Tick(float DeltaTime);
+	/**
+	 * Answers the HTTP upgrade request once it was fully received.
+	 */
+	void ReadHandshake();
+	/**
+	 * Unmasks the WebSocket frames received and handles the STOMP frames they carry.
+	 */
+	void ReadWebSocketFrames();
+	/**
+	 * Handles a single STOMP frame (without the null terminator).
+	 */
+	void HandleStompFrame(const FString& Frame);
+	/**
+	 * Sends a STOMP frame to the client in a single text message.
+	 */
+	bool SendStompFrame(const FString& Frame);
+	/**
+	 * Sends raw bytes to the client.
+	 */
+	bool SendBytes(TConstArrayView<uint8> Data);
+	/**
+	 * Drops the client connection.
+	 */
+	void CloseClient();
+
+	FSocket* Listener = nullptr;
+	FSocket* Client = nullptr;
+	bool bUpgraded = false;
+	TArray<uint8> ReceiveBuffer;
+	TArray<uint8> StompBuffer;
+	TMap<FString, FString> ConnectHeaders;
+	/**
+	 * Subscription id for each destination.
+	 */
+	TMap<FString, FString> Subscriptions;
+	int32 NextMessageId = 0;
+	FTSTicker::FDelegateHandle TickHandle;
+};
+
+/**
+ * Copies every property of the settings when created and restores them when destroyed, so a test can point the settings at the stand-ins.
+ */
+template <typename SettingsType>
+class TTolgeeTestSettingsOverride
+{
+public:
+	UE_NONCOPYABLE(TTolgeeTestSettingsOverride);
+
+	TTolgeeTestSettingsOverride()
+	{
+		FObjectWriter(GetMutableDefault<SettingsType>(), PreviousValues);
+	}
+
+	~TTolgeeTestSettingsOverride()
+	{
+		FObjectReader(GetMutableDefault<SettingsType>(), PreviousValues);
+	}
+
+	SettingsType* operator->() const { return GetMutableDefault<SettingsType>(); }
+
+private:
+	TArray<uint8> PreviousValues;
+};
+
+/**
+ * Standalone editor integration subsystem fetching a single project from the stand-in dashboard, so the engine-wide instance is left alone.
+ * The settings are restored and the disk cache of the project is deleted when it's destroyed.
+ */
+class FTolgeeTestEditorSubsystem
+{
+public:
+	UE_NONCOPYABLE(FTolgeeTestEditorSubsystem);
+
+	FTolgeeTestEditorSubsystem(const FString& ApiUrl, const FString& InProjectId);
+	~FTolgeeTestEditorSubsystem();
+
+	UTolgeeEditorIntegrationSubsystem* operator->() const { return Subsystem; }
+	/**
+	 * Seeds NumEntries translations of MakePoContent for the culture, as if the project had been exported earlier in the editor session.
+	 * NOTE: Projects loaded from the disk cache instead are exported in full on their first update check when delta sync is enabled.
+	 */
+	void SeedProject(const FString& Culture, int32 NumEntries, const FString& TranslationPrefix, const FDateTime& UpdateTime);
+
+	TTolgeeTestSettingsOverride<UTolgeeEditorSettings> Settings;
+
+private:
+	FString ProjectId;
+	TObjectPtr<UTolgeeEditorIntegrationSubsystem> Subsystem;
+};
+
+/**
+ * Test data shared by the editor tests.
+ */
+namespace TolgeeEditorTestUtils
+{
+	/**
+	 * @brief UTF-8 PO file with NumEntries translated entries in the Unreal format. Translations are built from a small vocabulary, like real UI text.
+	 */
+	TArray<uint8> MakePoContent(int32 NumEntries, const FString& TranslationPrefix = TEXT(""));
+	/**
+	 * @brief Compresses the content into a gzip member
+	 */
+	TArray<uint8> Gzip(TConstArrayView<uint8> Content);
+	/**
+	 * @brief Translation of the entry MakePoContent wrote at the given position, or an empty string if the index doesn't translate it
+	 */
+	FString FindTranslation(const FTolgeeCultureIndex& Index, int32 EntryIndex);
+	FString FindTranslation(const TMap<FString, FTolgeeCultureIndexRef>& Cultures, const FString& Culture, int32 EntryIndex);
+	/**
+	 * @brief Time as the Tolgee API serializes it
+	 */
+	int64 ToUnixMilliseconds(const FDateTime& Time);
+	/**
+	 * @brief Adds a latent command executing the predicate every frame until it returns true, fails the test after the timeout
+	 */
+	void WaitUntil(FAutomationTestBase& Test, TFunction<bool()> Predicate, const FString& Description, double Timeout = 10.0);
+} // namespace TolgeeEditorTestUtils
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TolgeeEditorIntegrationSubsystem.h"
+#include "TolgeeEditorTestUtils.h"
+
+namespace
+{
+	const TCHAR* FailedExportProjectId = TEXT("tolgee-automation-failed-export");
+
+	struct FFailedExportState
+	{
+		FTolgeeTestServer Server;
+		FTolgeeTestEditorSubsystem Subsystem{Server.GetUrl(), FailedExportProjectId};
+		FDateTime UpdateTime = FDateTime(2025, 1, 1);
+	};
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeEditorFailedExportTest, "Tolgee.Editor.Dashboard.FailedExport", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeEditorFailedExportTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFailedExportState> State = MakeShared<FFailedExportState>();
+	if (!TestTrue(TEXT("Stand-in dashboard started"), State->Server.IsValid()))
+	{
+		return false;
+	}
+
+	FFailedExportState* const ServedState = &State.Get();
+	const FString StatsPath = FString::Printf(TEXT("/v2/projects/%s/stats"), FailedExportProjectId);
+	const FString ExportPath = FString::Printf(TEXT("/v2/projects/%s/export"), FailedExportProjectId);
+
+	State->Server.AddRoute(StatsPath, [ServedState](const FHttpServerRequest& Request)
+	{
+		// The language was last updated before the export was sent, only the failure makes it worth exporting again.
+		return FTolgeeTestServer::MakeJsonResponse(FString::Printf(TEXT("{\"languageStats\":[{\"languageTag\":\"de\",\"translationsUpdatedAt\":%lld}]}"),
+		                                                         TolgeeEditorTestUtils::ToUnixMilliseconds(ServedState->UpdateTime)));
+	});
+	State->Server.AddRoute(ExportPath, [](const FHttpServerRequest& Request)
+	{
+		return FHttpServerResponse::Error(EHttpServerResponseCodes::ServerError);
+	});
+
+	State->Subsystem.Settings->bUseDeltaSync = false;
+	State->Subsystem.Settings->bUseLiveUpdates = false;
+	State->Subsystem->BeginSession();
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State, ExportPath]()
+	{
+		return State->Server.GetNumRequests(ExportPath) == 1 && State->Subsystem->NumRequestsCompleted == State->Subsystem->NumRequestsSent;
+	}, TEXT("the first export"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestFalse(TEXT("Fetch time of the failed export discarded"), State->Subsystem->ProjectFetchTimes.Contains(FailedExportProjectId));
+
+		State->Subsystem->RequestUpdateCheck();
+		return true;
+	}));
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State, StatsPath]()
+	{
+		return State->Server.GetNumRequests(StatsPath) == 1 && !State->Subsystem->bRequestInProgress;
+	}, TEXT("the update check"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, ExportPath]()
+	{
+		TestEqual(TEXT("Failed export retried by the update check"), State->Server.GetNumRequests(ExportPath), 2);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,137 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include <Misc/AutomationTest.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <HAL/PlatformTime.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeEditorCache.h"
+#include "TolgeeEditorIntegrationSubsystem.h"
+#include "TolgeeEditorTestUtils.h"
+
+namespace
+{
+	const TCHAR* LiveUpdatesProjectId = TEXT("tolgee-automation-live-updates");
+	const TCHAR* LiveUpdatesApiKey = TEXT("tgpak_automation");
+	constexpr int32 NumSeededEntries = 5;
+
+	struct FLiveUpdatesState
+	{
+		FTolgeeTestServer Server;
+		FTolgeeTestStompServer StompServer;
+		FTolgeeTestEditorSubsystem Subsystem{Server.GetUrl(), LiveUpdatesProjectId};
+		FDateTime UpdateTime = FDateTime(2025, 1, 1);
+		double EventTime = 0.0;
+		double PatchLatency = 0.0;
+	};
+
+	FString GetDestination()
+	{
+		return FString::Printf(TEXT("/projects/%s/translation-data-modified"), LiveUpdatesProjectId);
+	}
+
+	FString GetStatsPath()
+	{
+		return FString::Printf(TEXT("/v2/projects/%s/stats"), LiveUpdatesProjectId);
+	}
+
+	/**
+	 * Modified translation as Tolgee lists it in a translation-data-modified event, a null text means the translation was cleared.
+	 */
+	FString MakeModifiedTranslation(int32 EntryIndex, const FString& NewText)
+	{
+		const FString Text = NewText.IsEmpty() ? TEXT("null") : FString::Printf(TEXT("\"%s\""), *NewText);
+		return FString::Printf(TEXT("{\"id\":%d,\"modifications\":{\"text\":{\"old\":\"Alt\",\"new\":%s}},\"relations\":{\"key\":{\"entityId\":%d,\"data\":{\"name\":\"Namespace,Key%d\"}},\"language\":{\"entityId\":1,\"data\":{\"name\":\"German\",\"tag\":\"de\"}}}}"),
+		                       EntryIndex, *Text, EntryIndex, EntryIndex);
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTolgeeEditorLiveUpdatesTest, "Tolgee.Editor.Dashboard.LiveUpdates", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTolgeeEditorLiveUpdatesTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FLiveUpdatesState> State = MakeShared<FLiveUpdatesState>();
+	if (!TestTrue(TEXT("Stand-in dashboard started"), State->Server.IsValid()) || !TestTrue(TEXT("Stand-in STOMP endpoint started"), State->StompServer.IsValid()))
+	{
+		return false;
+	}
+
+	FLiveUpdatesState* const ServedState = &State.Get();
+	State->Server.AddRoute(GetStatsPath(), [ServedState](const FHttpServerRequest& Request)
+	{
+		// Nothing changed since the data was fetched, the checks never export anything.
+		return FTolgeeTestServer::MakeJsonResponse(FString::Printf(TEXT("{\"languageStats\":[{\"languageTag\":\"de\",\"translationsUpdatedAt\":%lld}]}"), TolgeeEditorTestUtils::ToUnixMilliseconds(ServedState->UpdateTime)));
+	});
+
+	State->Subsystem.Settings->ApiKey = LiveUpdatesApiKey;
+	State->Subsystem.SeedProject(TEXT("de"), NumSeededEntries, TEXT("Alt "), State->UpdateTime);
+	State->Subsystem->ConnectLiveUpdates(State->StompServer.GetUrl());
+
+	// Once subscribed, the subsystem checks once for the changes it missed while it wasn't connected.
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]()
+	{
+		return State->StompServer.IsSubscribed(GetDestination()) && State->Server.GetNumRequests(GetStatsPath()) == 1 && !State->Subsystem->bRequestInProgress;
+	}, TEXT("the live updates subscription"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestEqual(TEXT("API key sent with CONNECT"), State->StompServer.GetConnectHeaders().FindRef(TEXT("x-api-key")), FString(LiveUpdatesApiKey));
+		TestTrue(TEXT("Polling paused while connected"), State->Subsystem->bLiveUpdatesConnected);
+
+		const FString Event = FString::Printf(TEXT("{\"activityId\":1,\"sourceActivity\":\"SET_TRANSLATIONS\",\"dataCollapsed\":false,\"data\":{\"translations\":[%s,%s,%s]}}"),
+		                                      *MakeModifiedTranslation(1, TEXT("Live 1")), *MakeModifiedTranslation(2, TEXT("")), *MakeModifiedTranslation(7, TEXT("Live 7")));
+
+		State->EventTime = FPlatformTime::Seconds();
+		TestTrue(TEXT("Event sent"), State->StompServer.SendMessage(GetDestination(), Event));
+		return true;
+	}));
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]()
+	{
+		if (TolgeeEditorTestUtils::FindTranslation(State->Subsystem->CachedTranslations, TEXT("de"), 1) != TEXT("Live 1"))
+		{
+			return false;
+		}
+
+		State->PatchLatency = FPlatformTime::Seconds() - State->EventTime;
+		return true;
+	}, TEXT("the pushed change to be injected"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		const TMap<FString, FTolgeeCultureIndexRef>& Injected = State->Subsystem->CachedTranslations;
+		TestTrue(TEXT("Untouched entry kept"), TolgeeEditorTestUtils::FindTranslation(Injected, TEXT("de"), 0).StartsWith(TEXT("Alt ")));
+		TestEqual(TEXT("Cleared entry removed"), TolgeeEditorTestUtils::FindTranslation(Injected, TEXT("de"), 2), FString());
+		TestEqual(TEXT("New entry added"), TolgeeEditorTestUtils::FindTranslation(Injected, TEXT("de"), 7), FString(TEXT("Live 7")));
+		TestEqual(TEXT("Pushed change applied without a request"), State->Server.GetNumRequests(GetStatsPath()), 1);
+		AddInfo(FString::Printf(TEXT("Pushed change injected %.2f ms after the event was sent."), State->PatchLatency * 1000.0));
+
+		// Events that don't list the changes fall back to the update check.
+		TestTrue(TEXT("Collapsed event sent"), State->StompServer.SendMessage(GetDestination(), TEXT("{\"activityId\":2,\"sourceActivity\":\"IMPORT\",\"dataCollapsed\":true,\"data\":null}")));
+		return true;
+	}));
+
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]()
+	{
+		return State->Server.GetNumRequests(GetStatsPath()) == 2 && !State->Subsystem->bRequestInProgress;
+	}, TEXT("the update check after the collapsed event"));
+
+	// NOTE: The patched culture is saved once no other event arrived for a while, the state only deletes the cache once the write completed.
+	TolgeeEditorTestUtils::WaitUntil(*this, [State]()
+	{
+		FTolgeeEditorProjectCache Project;
+		return TolgeeEditorCache::Load(LiveUpdatesProjectId, Project) && TolgeeEditorTestUtils::FindTranslation(Project.Cultures, TEXT("de"), 1) == TEXT("Live 1");
+	}, TEXT("the project cache"));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		TestEqual(TEXT("Update time kept until a check confirms it"), State->Subsystem->LanguageUpdateTimes.FindChecked(LiveUpdatesProjectId).FindRef(TEXT("de")), State->UpdateTime);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
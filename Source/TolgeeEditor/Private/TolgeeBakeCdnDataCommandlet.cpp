@@ -0,0 +1,122 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeBakeCdnDataCommandlet.h"
+
+#include <Interfaces/IHttpResponse.h>
+#include <Kismet/KismetInternationalizationLibrary.h>
+#include <Settings/ProjectPackagingSettings.h>
+
+#include "TolgeeCultureIndex.h"
+#include "TolgeeLog.h"
+#include "TolgeePoParser.h"
+#include "TolgeeRuntimeSettings.h"
+#include "TolgeeUtils.h"
+
+UTolgeeBakeCdnDataCommandlet::UTolgeeBakeCdnDataCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTolgeeBakeCdnDataCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const UTolgeeRuntimeSettings* Settings = GetDefault<UTolgeeRuntimeSettings>();
+	if (Settings->CdnAddresses.IsEmpty())
+	{
+		UE_LOG(LogTolgee, Error, TEXT("No CDN addresses configured, there is nothing to bake."));
+		return 1;
+	}
+
+	TArray<FString> Cultures;
+	if (const FString* CulturesParam = ParamValues.Find(TEXT("cultures")))
+	{
+		CulturesParam->ParseIntoArray(Cultures, TEXT(","));
+	}
+	else
+	{
+		Cultures = UKismetInternationalizationLibrary::GetLocalizedCultures();
+	}
+
+	const FString* OutputParam = ParamValues.Find(TEXT("output"));
+	const FString OutputDirectory = OutputParam ? *OutputParam : TolgeeCdnCache::GetBakedDirectory();
+
+	int32 NumFailedFiles = 0;
+	const TArray<FTolgeeCdnCacheEntry> Files = TolgeeCdnCache::GetFiles(Cultures);
+	for (const FTolgeeCdnCacheEntry& File : Files)
+	{
+		if (!BakeFile(File, OutputDirectory))
+		{
+			NumFailedFiles++;
+		}
+	}
+
+	if (!OutputParam)
+	{
+		const UProjectPackagingSettings* PackagingSettings = GetDefault<UProjectPackagingSettings>();
+		const bool bIsStaged = PackagingSettings->DirectoriesToAlwaysStageAsUFS.ContainsByPredicate(
+			[](const FDirectoryPath& Directory)
+			{
+				return Directory.Path == TEXT("Tolgee") || Directory.Path == TEXT("Tolgee/Baked");
+			}
+		);
+		if (!bIsStaged)
+		{
+			UE_LOG(LogTolgee, Warning, TEXT("Tolgee/Baked is not listed in the Additional Non-Asset Directories to Package, the baked data won't be part of the build."));
+		}
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("Baked %d of %d CDN files into %s."), Files.Num() - NumFailedFiles, Files.Num(), *OutputDirectory);
+	return NumFailedFiles > 0 ? 1 : 0;
+}
+
+bool UTolgeeBakeCdnDataCommandlet::BakeFile(const FTolgeeCdnCacheEntry& File, const FString& OutputDirectory) const
+{
+	const FHttpRequestRef HttpRequest = TolgeeUtils::CreateCdnRequest(File.Url);
+	HttpRequest->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+
+	HttpRequest->ProcessRequestUntilComplete();
+
+	const FHttpResponsePtr Response = HttpRequest->GetResponse();
+	if (!Response || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		UE_LOG(LogTolgee, Error, TEXT("Failed to download %s for %s. Response code: %d"), *File.Url, *File.Culture, Response ? Response->GetResponseCode() : 0);
+		return false;
+	}
+
+	TArray<uint8> DecompressedContent;
+	TConstArrayView<uint8> Content;
+	if (!TolgeeUtils::DecodeContent(Response->GetContent(), DecompressedContent, Content))
+	{
+		UE_LOG(LogTolgee, Error, TEXT("Failed to decompress %s for %s."), *File.Url, *File.Culture);
+		return false;
+	}
+
+	FTolgeeCultureIndexBuilder Builder;
+	if (!TolgeePoParser::ParseIntoIndex(Content, Builder))
+	{
+		UE_LOG(LogTolgee, Error, TEXT("Failed to parse %s for %s."), *File.Url, *File.Culture);
+		return false;
+	}
+
+	FTolgeeCdnCacheEntry Entry = File;
+	Entry.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+	Entry.ETag = Response->GetHeader(TEXT("ETag"));
+	Entry.ContentHash = TolgeeCdnCache::HashContent(Content);
+	Entry.ContentSize = Content.Num();
+
+	const FTolgeeCultureIndexRef Translations = Builder.Build();
+	if (!TolgeeCdnCache::Save(Entry, *Translations, OutputDirectory))
+	{
+		return false;
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("Baked %d translations for %s from %s."), Translations->Num(), *File.Culture, *File.Url);
+	return true;
+}
@@ -0,0 +1,206 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeEditorCache.h"
+
+#include <Dom/JsonObject.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Guid.h>
+#include <Misc/Paths.h>
+#include <Misc/ScopeLock.h>
+#include <Misc/SecureHash.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <Serialization/JsonWriter.h>
+
+#include "TolgeeCultureIndexFile.h"
+#include "TolgeeEditorSettings.h"
+#include "TolgeeLog.h"
+
+namespace
+{
+	FString GetProjectDirectory(const FString& ProjectId)
+	{
+		return TolgeeEditorCache::GetCacheDirectory() / ProjectId;
+	}
+
+	FString GetCulturePath(const FString& ProjectId, const FString& Culture)
+	{
+		return GetProjectDirectory(ProjectId) / Culture + TEXT(".bin");
+	}
+
+	FString GetDescriptionPath(const FString& ProjectId)
+	{
+		return GetProjectDirectory(ProjectId) / TEXT("project.json");
+	}
+
+	int64 ToUnixMilliseconds(const FDateTime& Time)
+	{
+		return static_cast<int64>((Time - FDateTime::FromUnixTimestamp(0)).GetTotalMilliseconds());
+	}
+
+	FDateTime FromUnixMilliseconds(int64 Milliseconds)
+	{
+		return FDateTime::FromUnixTimestamp(0) + FTimespan::FromMilliseconds(Milliseconds);
+	}
+
+	/**
+	 * Reads the description of a cached project, null if it's missing, corrupted or was fetched from a different Tolgee instance.
+	 */
+	TSharedPtr<FJsonObject> LoadDescription(const FString& ProjectId)
+	{
+		FString DescriptionContent;
+		if (!FFileHelper::LoadFileToString(DescriptionContent, *GetDescriptionPath(ProjectId)))
+		{
+			return nullptr;
+		}
+
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(DescriptionContent);
+		TSharedPtr<FJsonObject> JsonObject;
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			UE_LOG(LogTolgee, Warning, TEXT("Failed to read cached description for project %s."), *ProjectId);
+			return nullptr;
+		}
+
+		// NOTE: Project ids are only unique per Tolgee instance.
+		if (JsonObject->GetStringField(TEXT("apiUrl")) != GetDefault<UTolgeeEditorSettings>()->GetBaseUrl())
+		{
+			return nullptr;
+		}
+
+		return JsonObject;
+	}
+
+	/**
+	 * Identifier of the latest snapshot handed out by MakeSaveId.
+	 */
+	TAtomic<uint32> LatestSaveId = 0;
+	/**
+	 * Identifier of the snapshot written last for each project, snapshots older than it are dropped.
+	 */
+	TMap<FString, uint32> WrittenSaveIds;
+	/**
+	 * Serializes the writes of the cache and guards WrittenSaveIds.
+	 */
+	FCriticalSection SaveCriticalSection;
+} // namespace
+
+FString TolgeeEditorCache::GetCacheDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Tolgee") / TEXT("In-Context");
+}
+
+uint32 TolgeeEditorCache::MakeSaveId()
+{
+	return ++LatestSaveId;
+}
+
+bool TolgeeEditorCache::Save(const FString& ProjectId, const FTolgeeEditorProjectCache& Project, const TSet<FString>& ChangedCultures, uint32 SaveId)
+{
+	FScopeLock Lock(&SaveCriticalSection);
+
+	uint32& WrittenSaveId = WrittenSaveIds.FindOrAdd(ProjectId);
+	if (WrittenSaveId > SaveId)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding outdated cache snapshot of project %s."), *ProjectId);
+		return true;
+	}
+
+	// NOTE: The cultures that didn't change keep the files the previous save tagged.
+	const TSharedPtr<FJsonObject> PreviousDescription = LoadDescription(ProjectId);
+	const TSharedPtr<FJsonObject>* PreviousCulturesObject = nullptr;
+	if (PreviousDescription.IsValid())
+	{
+		PreviousDescription->TryGetObjectField(TEXT("cultures"), PreviousCulturesObject);
+	}
+
+	const TSharedRef<FJsonObject> CulturesObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FTolgeeCultureIndexRef>& Culture : Project.Cultures)
+	{
+		FString PreviousTag;
+		if (!ChangedCultures.Contains(Culture.Key) && PreviousCulturesObject && (*PreviousCulturesObject)->TryGetStringField(Culture.Key, PreviousTag))
+		{
+			CulturesObject->SetStringField(Culture.Key, PreviousTag);
+			continue;
+		}
+
+		// NOTE: There is no source content to hash, a random GUID in the space of the hash ties the file to this description instead.
+		static_assert(sizeof(FGuid) <= sizeof(FSHAHash::Hash), "The tag has to fit in the content hash of the file");
+		const FGuid Tag = FGuid::NewGuid();
+		FSHAHash TagHash;
+		FMemory::Memcpy(TagHash.Hash, &Tag, sizeof(Tag));
+		const FString TagString = TagHash.ToString();
+
+		if (!TolgeeCultureIndexFile::Save(GetCulturePath(ProjectId, Culture.Key), *Culture.Value, TagString))
+		{
+			UE_LOG(LogTolgee, Warning, TEXT("Failed to write cached culture %s for project %s."), *Culture.Key, *ProjectId);
+			return false;
+		}
+
+		CulturesObject->SetStringField(Culture.Key, TagString);
+	}
+
+	const TSharedRef<FJsonObject> LanguagesObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FDateTime>& Language : Project.LanguageUpdateTimes)
+	{
+		LanguagesObject->SetNumberField(Language.Key, ToUnixMilliseconds(Language.Value));
+	}
+
+	const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("apiUrl"), GetDefault<UTolgeeEditorSettings>()->GetBaseUrl());
+	JsonObject->SetObjectField(TEXT("cultures"), CulturesObject);
+	JsonObject->SetObjectField(TEXT("languages"), LanguagesObject);
+	JsonObject->SetNumberField(TEXT("fetchedAt"), ToUnixMilliseconds(Project.FetchTime));
+
+	FString DescriptionContent;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&DescriptionContent);
+	FJsonSerializer::Serialize(JsonObject, JsonWriter);
+
+	if (!FFileHelper::SaveStringToFile(DescriptionContent, *GetDescriptionPath(ProjectId)))
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Failed to write cached description for project %s."), *ProjectId);
+		return false;
+	}
+
+	WrittenSaveId = SaveId;
+	return true;
+}
+
+bool TolgeeEditorCache::Load(const FString& ProjectId, FTolgeeEditorProjectCache& OutProject)
+{
+	const TSharedPtr<FJsonObject> JsonObject = LoadDescription(ProjectId);
+	if (!JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* CulturesObject = nullptr;
+	const TSharedPtr<FJsonObject>* LanguagesObject = nullptr;
+	if (!JsonObject->TryGetObjectField(TEXT("cultures"), CulturesObject) || !JsonObject->TryGetObjectField(TEXT("languages"), LanguagesObject))
+	{
+		return false;
+	}
+
+	FTolgeeEditorProjectCache Project;
+	Project.FetchTime = FromUnixMilliseconds(static_cast<int64>(JsonObject->GetNumberField(TEXT("fetchedAt"))));
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Culture : (*CulturesObject)->Values)
+	{
+		TOptional<FTolgeeCultureIndexRef> Translations = TolgeeCultureIndexFile::Load(GetCulturePath(ProjectId, Culture.Key), Culture.Value->AsString());
+		if (!Translations.IsSet())
+		{
+			UE_LOG(LogTolgee, Warning, TEXT("Failed to read cached culture %s for project %s."), *Culture.Key, *ProjectId);
+			return false;
+		}
+
+		Project.Cultures.Add(Culture.Key, Translations.GetValue());
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Language : (*LanguagesObject)->Values)
+	{
+		Project.LanguageUpdateTimes.Add(Language.Key, FromUnixMilliseconds(static_cast<int64>(Language.Value->AsNumber())));
+	}
+
+	OutProject = MoveTemp(Project);
+	return true;
+}
@@ -2,18 +2,33 @@
 
 #include "TolgeeEditorIntegrationSubsystem.h"
 
+#include <Async/Async.h>
+#include <PlatformHttp.h>
 #include <HttpModule.h>
 #include <Interfaces/IHttpRequest.h>
 #include <Interfaces/IHttpResponse.h>
-#include <Misc/FileHelper.h>
+#include <Async/ParallelFor.h>
 #include <FileUtilities/ZipArchiveReader.h>
-#include <HAL/PlatformFileManager.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <WebSocketsModule.h>
 
+#include "TolgeeEditorCache.h"
 #include "TolgeeEditorSettings.h"
 #include "TolgeeLog.h"
+#include "TolgeeMemoryFileHandle.h"
 #include "TolgeeRuntimeSettings.h"
+#include "TolgeeStompClient.h"
 #include "TolgeeUtils.h"
 
+namespace
+{
+	/**
+	 * Time in seconds without live updates before the patched cultures are saved, so bursts of events are written once.
+	 */
+	constexpr float LiveUpdateSaveDelay = 2.0f;
+} // namespace
+
 void UTolgeeEditorIntegrationSubsystem::ManualFetch()
 {
 	FetchIUpdatesAreAvailableAsync();
@@ -38,34 +53,542 @@ void UTolgeeEditorIntegrationSubsystem::OnGameInstanceStart(UGameInstance* GameI
 	FTimerDelegate Delegate = FTimerDelegate::CreateUObject(this, &ThisClass::OnRefreshTick);
 	GameInstance->GetWorld()->GetTimerManager().SetTimer(RefreshTick, Delegate, EditorSettings->RefreshInterval, true);
 
-	FetchAllProjects();
+	BeginSession();
 }
 
 void UTolgeeEditorIntegrationSubsystem::OnGameInstanceEnd(bool bIsSimulating)
 {
+	DisconnectLiveUpdates();
 	ResetData();
 }
 
-TMap<FString, TArray<FTolgeeTranslationData>> UTolgeeEditorIntegrationSubsystem::GetDataToInject() const
+void UTolgeeEditorIntegrationSubsystem::BeginSession()
+{
+	const UTolgeeEditorSettings* EditorSettings = GetDefault<UTolgeeEditorSettings>();
+
+	const TArray<FString> MissingProjects = InjectCachedProjects();
+	FetchProjects(MissingProjects);
+
+	if (EditorSettings->bUseLiveUpdates)
+	{
+		ConnectLiveUpdates();
+	}
+	else if (MissingProjects.Num() < EditorSettings->ProjectIds.Num())
+	{
+		// NOTE: The cached data is revalidated through the stats check, only what changed since it was fetched is requested again.
+		RequestUpdateCheck();
+	}
+}
+
+void UTolgeeEditorIntegrationSubsystem::ConnectLiveUpdates()
+{
+	ReconnectHandle.Reset();
+
+	// NOTE: Tolgee exposes STOMP through SockJS, which accepts raw WebSocket connections on the /websocket transport.
+	FString Url = GetDefault<UTolgeeEditorSettings>()->GetBaseUrl() + TEXT("/websocket/websocket");
+	if (Url.StartsWith(TEXT("https://")))
+	{
+		Url = TEXT("wss://") + Url.RightChop(8);
+	}
+	else if (Url.StartsWith(TEXT("http://")))
+	{
+		Url = TEXT("ws://") + Url.RightChop(7);
+	}
+
+	ConnectLiveUpdates(Url);
+}
+
+void UTolgeeEditorIntegrationSubsystem::ConnectLiveUpdates(const FString& Url)
+{
+	FModuleManager::LoadModuleChecked<FWebSocketsModule>(TEXT("WebSockets"));
+
+	if (LiveUpdatesClient)
+	{
+		LiveUpdatesClient->Close();
+	}
+
+	LiveUpdatesClient = MakeShared<FTolgeeStompClient>();
+	LiveUpdatesClient->OnConnected.BindUObject(this, &ThisClass::OnLiveUpdatesConnected);
+	LiveUpdatesClient->OnMessage.BindUObject(this, &ThisClass::OnLiveUpdateReceived);
+	LiveUpdatesClient->OnClosed.BindUObject(this, &ThisClass::OnLiveUpdatesClosed);
+
+	TMap<FString, FString> ConnectHeaders;
+	ConnectHeaders.Add(TEXT("x-api-key"), GetDefault<UTolgeeEditorSettings>()->ApiKey);
+
+	UE_LOG(LogTolgee, Display, TEXT("Connecting to live updates at %s"), *Url);
+	LiveUpdatesClient->Connect(Url, ConnectHeaders);
+}
+
+void UTolgeeEditorIntegrationSubsystem::DisconnectLiveUpdates()
+{
+	if (ReconnectHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReconnectHandle);
+		ReconnectHandle.Reset();
+	}
+
+	if (LiveUpdatesClient)
+	{
+		LiveUpdatesClient->Close();
+		LiveUpdatesClient.Reset();
+	}
+
+	bLiveUpdatesConnected = false;
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnLiveUpdatesConnected()
+{
+	for (const FString& ProjectId : GetDefault<UTolgeeEditorSettings>()->ProjectIds)
+	{
+		LiveUpdatesClient->Subscribe(FString::Printf(TEXT("/projects/%s/translation-data-modified"), *ProjectId));
+	}
+
+	UE_LOG(LogTolgee, Display, TEXT("Live updates active, polling is paused."));
+	bLiveUpdatesConnected = true;
+
+	// NOTE: Changes made while we weren't connected are not pushed, so we check once right away.
+	RequestUpdateCheck();
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnLiveUpdateReceived(const FString& Destination, const FString& Body)
+{
+	UE_LOG(LogTolgee, Verbose, TEXT("Live update received on %s"), *Destination);
+
+	// NOTE: Events are published on /projects/<ProjectId>/translation-data-modified.
+	TArray<FString> DestinationParts;
+	Destination.ParseIntoArray(DestinationParts, TEXT("/"));
+	const FString ProjectId = DestinationParts.Num() == 3 ? DestinationParts[1] : FString();
+
+	// NOTE: An export started before the change could undo the patch once it completes, so while requests are in flight the update check is queued behind them instead.
+	const bool bCanPatch = ProjectTranslations.Contains(ProjectId) && !bRequestInProgress && NumRequestsCompleted == NumRequestsSent;
+
+	TMap<FString, TMap<FString, FString>> Changes;
+	if (!bCanPatch || !ReadLiveUpdate(Body, Changes))
+	{
+		UE_LOG(LogTolgee, Display, TEXT("Live update for project %s can't be patched in, checking for updates instead."), *ProjectId);
+		RequestUpdateCheck();
+		return;
+	}
+
+	if (Changes.IsEmpty())
+	{
+		return;
+	}
+
+	PatchLiveUpdate(ProjectId, Changes);
+}
+
+void UTolgeeEditorIntegrationSubsystem::PatchLiveUpdate(const FString& ProjectId, const TMap<FString, TMap<FString, FString>>& Changes)
 {
-	return CachedTranslations;
+	check(IsInGameThread());
+
+	const TMap<FString, FTolgeeCultureIndexRef>& LiveCultures = ProjectTranslations.FindChecked(ProjectId);
+
+	TMap<FString, TMap<FString, FTolgeeCultureIndexRef>> PatchedTranslations;
+	TMap<FString, FTolgeeCultureIndexRef>& PatchedCultures = PatchedTranslations.Add(ProjectId);
+	for (const TPair<FString, TMap<FString, FString>>& Culture : Changes)
+	{
+		PatchedCultures.Add(Culture.Key, PatchCulture(LiveCultures.Find(Culture.Key), Culture.Value));
+	}
+
+	// NOTE: The event carries no update times, the languages keep the previous ones so the next update check still confirms them.
+	UE_LOG(LogTolgee, Display, TEXT("Live update patched %d cultures of project %s."), Changes.Num(), *ProjectId);
+	ApplyProjectTranslations(PatchedTranslations);
+
+	// NOTE: Every event restarts the delay, the cultures patched in the meantime are written together.
+	LiveUpdatedProjects.Add(ProjectId);
+	FTSTicker::GetCoreTicker().RemoveTicker(LiveUpdateSaveHandle);
+	LiveUpdateSaveHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		LiveUpdateSaveHandle.Reset();
+		SaveProjectsToCache(LiveUpdatedProjects.Array());
+		LiveUpdatedProjects.Empty();
+		return false;
+	}), LiveUpdateSaveDelay);
+}
+
+bool UTolgeeEditorIntegrationSubsystem::ReadLiveUpdate(const FString& Body, TMap<FString, TMap<FString, FString>>& OutChanges)
+{
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Body);
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	{
+		return false;
+	}
+
+	// NOTE: Activities modifying many entities are sent collapsed, without the entities.
+	bool bDataCollapsed = false;
+	JsonObject->TryGetBoolField(TEXT("dataCollapsed"), bDataCollapsed);
+
+	const TSharedPtr<FJsonObject>* Data = nullptr;
+	if (bDataCollapsed || !JsonObject->TryGetObjectField(TEXT("data"), Data))
+	{
+		return false;
+	}
+
+	// NOTE: A renamed or deleted key moves all its translations, the update check resolves those. New keys come with their translations.
+	const TArray<TSharedPtr<FJsonValue>>* Keys = nullptr;
+	if ((*Data)->TryGetArrayField(TEXT("keys"), Keys))
+	{
+		for (const TSharedPtr<FJsonValue>& KeyValue : *Keys)
+		{
+			const TSharedPtr<FJsonObject>* Key = nullptr;
+			const TSharedPtr<FJsonObject>* Modifications = nullptr;
+			const TSharedPtr<FJsonObject>* Name = nullptr;
+			FString OldName;
+			if (!KeyValue->TryGetObject(Key))
+			{
+				return false;
+			}
+			if ((*Key)->TryGetObjectField(TEXT("modifications"), Modifications) && (*Modifications)->TryGetObjectField(TEXT("name"), Name) && (*Name)->TryGetStringField(TEXT("old"), OldName))
+			{
+				return false;
+			}
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Translations = nullptr;
+	if (!(*Data)->TryGetArrayField(TEXT("translations"), Translations))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& TranslationValue : *Translations)
+	{
+		const TSharedPtr<FJsonObject>* Translation = nullptr;
+		if (!TranslationValue->TryGetObject(Translation))
+		{
+			return false;
+		}
+
+		// NOTE: Changes that don't touch the text (e.g. the translation state) don't affect what's injected.
+		const TSharedPtr<FJsonObject>* Modifications = nullptr;
+		const TSharedPtr<FJsonObject>* Text = nullptr;
+		if (!(*Translation)->TryGetObjectField(TEXT("modifications"), Modifications) || !(*Modifications)->TryGetObjectField(TEXT("text"), Text))
+		{
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>* Relations = nullptr;
+		const TSharedPtr<FJsonObject>* Key = nullptr;
+		const TSharedPtr<FJsonObject>* KeyData = nullptr;
+		const TSharedPtr<FJsonObject>* Language = nullptr;
+		const TSharedPtr<FJsonObject>* LanguageData = nullptr;
+		FString KeyName;
+		FString LanguageTag;
+		if (!(*Translation)->TryGetObjectField(TEXT("relations"), Relations)
+			|| !(*Relations)->TryGetObjectField(TEXT("key"), Key) || !(*Key)->TryGetObjectField(TEXT("data"), KeyData) || !(*KeyData)->TryGetStringField(TEXT("name"), KeyName)
+			|| !(*Relations)->TryGetObjectField(TEXT("language"), Language) || !(*Language)->TryGetObjectField(TEXT("data"), LanguageData) || !(*LanguageData)->TryGetStringField(TEXT("tag"), LanguageTag))
+		{
+			return false;
+		}
+
+		// NOTE: The new text is null once the translation was cleared, which is stored as an empty change like in the delta pages.
+		FString NewText;
+		(*Text)->TryGetStringField(TEXT("new"), NewText);
+		OutChanges.FindOrAdd(LanguageTag).Add(KeyName, NewText);
+	}
+
+	return true;
 }
 
-void UTolgeeEditorIntegrationSubsystem::FetchAllProjects()
+void UTolgeeEditorIntegrationSubsystem::OnLiveUpdatesClosed(const FString& Reason)
 {
+	UE_LOG(LogTolgee, Warning, TEXT("Live updates disconnected, falling back to polling. Reconnecting in %.1f seconds."), GetDefault<UTolgeeEditorSettings>()->LiveUpdatesReconnectDelay);
+
+	// NOTE: The client is executing this callback, so it's only replaced once we reconnect.
+	bLiveUpdatesConnected = false;
+
+	const float Delay = GetDefault<UTolgeeEditorSettings>()->LiveUpdatesReconnectDelay;
+	ReconnectHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		ConnectLiveUpdates();
+		return false;
+	}), Delay);
+}
+
+void UTolgeeEditorIntegrationSubsystem::RequestUpdateCheck()
+{
+	if (bRequestInProgress)
+	{
+		bUpdateCheckQueued = true;
+		return;
+	}
+
+	FetchIUpdatesAreAvailableAsync();
+}
+
+TArray<FString> UTolgeeEditorIntegrationSubsystem::InjectCachedProjects()
+{
+	check(IsInGameThread());
+
 	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
 
+	// NOTE: Project ids are only unique per Tolgee instance, data kept from another one can't be reused.
+	if (ProjectTranslationsUrl != Settings->GetBaseUrl())
+	{
+		ProjectTranslations.Empty();
+		LanguageUpdateTimes.Empty();
+		ProjectFetchTimes.Empty();
+		FullyExportedProjects.Empty();
+		UnsavedCultures.Empty();
+		LayeredCultures.Empty();
+		LayeredProjectIds.Empty();
+		ProjectTranslationsUrl = Settings->GetBaseUrl();
+	}
+
+	TMap<FString, TMap<FString, FTolgeeCultureIndexRef>> LoadedProjects;
+	TArray<FString> MissingProjects;
 	for (const FString& ProjectId : Settings->ProjectIds)
+	{
+		if (ProjectTranslations.Contains(ProjectId))
+		{
+			continue;
+		}
+
+		FTolgeeEditorProjectCache Project;
+		if (TolgeeEditorCache::Load(ProjectId, Project))
+		{
+			UE_LOG(LogTolgee, Display, TEXT("Loaded %d cached cultures for project %s."), Project.Cultures.Num(), *ProjectId);
+			ProjectTranslations.Emplace(ProjectId, Project.Cultures);
+			LoadedProjects.Emplace(ProjectId, MoveTemp(Project.Cultures));
+			LanguageUpdateTimes.Emplace(ProjectId, MoveTemp(Project.LanguageUpdateTimes));
+			ProjectFetchTimes.Emplace(ProjectId, Project.FetchTime);
+			// NOTE: Keys deleted on the dashboard since the cache was written are still in it, the first check exports the project again.
+			FullyExportedProjects.Remove(ProjectId);
+		}
+		else
+		{
+			MissingProjects.Add(ProjectId);
+		}
+	}
+
+	// NOTE: The projects kept from the last session are still layered, unless the configured projects changed since then.
+	LayerProjectTranslations(LoadedProjects);
+
+	if (!CachedTranslations.IsEmpty())
+	{
+		PublishTranslations(CachedTranslations);
+		QueueRefresh();
+	}
+
+	return MissingProjects;
+}
+
+void UTolgeeEditorIntegrationSubsystem::FetchProjects(const TArray<FString>& ProjectIds)
+{
+	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
+
+	for (const FString& ProjectId : ProjectIds)
 	{
 		const FString RequestUrl = FString::Printf(TEXT("%s/v2/projects/%s/export?format=PO"), *Settings->GetBaseUrl(), *ProjectId);
 		UE_LOG(LogTolgee, Display, TEXT("Fetching localization data for project %s from Tolgee dashboard: %s"), *ProjectId, *RequestUrl);
-		FetchFromDashboard(ProjectId, RequestUrl);
+		FetchFromDashboard(ProjectId, RequestUrl, {});
+
+		PendingFetchTimes.Emplace(ProjectId, FDateTime::UtcNow());
+		FullyExportedProjects.Add(ProjectId);
 	}
+}
 
-	LastFetchTime = FDateTime::UtcNow();
+void UTolgeeEditorIntegrationSubsystem::FetchProjectLanguages(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates)
+{
+	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
+
+	TArray<FString> Parameters = {TEXT("format=PO")};
+	for (const TPair<FString, FDateTime>& Language : LanguageUpdates)
+	{
+		Parameters.Add(FString::Printf(TEXT("languages=%s"), *Language.Key));
+	}
+
+	const FString BaseUrl = FString::Printf(TEXT("%s/v2/projects/%s/export"), *Settings->GetBaseUrl(), *ProjectId);
+	const FString RequestUrl = TolgeeUtils::AppendQueryParameters(BaseUrl, Parameters);
+	UE_LOG(LogTolgee, Display, TEXT("Fetching %d updated languages for project %s from Tolgee dashboard: %s"), LanguageUpdates.Num(), *ProjectId, *RequestUrl);
+	FetchFromDashboard(ProjectId, RequestUrl, LanguageUpdates);
+}
+
+void UTolgeeEditorIntegrationSubsystem::FetchProjectDelta(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const FDateTime& RevisedAfter)
+{
+	UE_LOG(LogTolgee, Display, TEXT("Fetching keys revised after %s for project %s from Tolgee dashboard."), *RevisedAfter.ToString(), *ProjectId);
+
+	NumRequestsSent++;
+	FetchProjectDeltaPage(ProjectId, LanguageUpdates, RevisedAfter, {}, MakeShared<TMap<FString, TMap<FString, FString>>, ESPMode::ThreadSafe>());
 }
 
-void UTolgeeEditorIntegrationSubsystem::FetchFromDashboard(const FString& ProjectId, const FString& RequestUrl)
+void UTolgeeEditorIntegrationSubsystem::FetchProjectDeltaPage(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const FDateTime& RevisedAfter, const FString& Cursor, TSharedRef<TMap<FString, TMap<FString, FString>>, ESPMode::ThreadSafe> Changes)
+{
+	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
+	const int64 RevisedAfterMilliseconds = static_cast<int64>((RevisedAfter - FDateTime::FromUnixTimestamp(0)).GetTotalMilliseconds());
+
+	TArray<FString> Parameters;
+	Parameters.Add(FString::Printf(TEXT("size=%d"), Settings->DeltaSyncPageSize));
+	Parameters.Add(TEXT("sort=keyId"));
+	Parameters.Add(FString::Printf(TEXT("filterRevisedAfter=%lld"), RevisedAfterMilliseconds));
+	if (!Cursor.IsEmpty())
+	{
+		Parameters.Add(FString::Printf(TEXT("cursor=%s"), *FPlatformHttp::UrlEncode(Cursor)));
+	}
+
+	for (const TPair<FString, FDateTime>& Language : LanguageUpdates)
+	{
+		Parameters.Add(FString::Printf(TEXT("languages=%s"), *Language.Key));
+	}
+
+	const FString BaseUrl = FString::Printf(TEXT("%s/v2/projects/%s/translations"), *Settings->GetBaseUrl(), *ProjectId);
+
+	FHttpRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(TolgeeUtils::AppendQueryParameters(BaseUrl, Parameters));
+	HttpRequest->SetVerb("GET");
+	HttpRequest->SetHeader(TEXT("X-API-Key"), Settings->ApiKey);
+	TolgeeUtils::AddSdkHeaders(HttpRequest);
+
+	TolgeeUtils::ProcessRequestAsync(HttpRequest).Next([WeakThis = TWeakObjectPtr<ThisClass>(this), ProjectId, LanguageUpdates, RevisedAfter, Changes, PageSize = Settings->DeltaSyncPageSize, Generation = FetchGeneration](FHttpResponsePtr Response)
+	{
+		if (!WeakThis.IsValid())
+		{
+			return;
+		}
+
+		int32 NumKeys = 0;
+		FString NextCursor;
+		const bool bSuccess = ReadDeltaPage(Response, *Changes, NumKeys, NextCursor);
+
+		// NOTE: A full page means more keys might follow, the cursor points right after the last key we received.
+		if (bSuccess && NumKeys == PageSize && !NextCursor.IsEmpty() && Generation == WeakThis->FetchGeneration)
+		{
+			WeakThis->FetchProjectDeltaPage(ProjectId, LanguageUpdates, RevisedAfter, NextCursor, Changes);
+			return;
+		}
+
+		WeakThis->OnProjectDeltaRead(ProjectId, LanguageUpdates, *Changes, bSuccess, Generation);
+	});
+}
+
+bool UTolgeeEditorIntegrationSubsystem::ReadDeltaPage(const FHttpResponsePtr& Response, TMap<FString, TMap<FString, FString>>& OutChanges, int32& OutNumKeys, FString& OutNextCursor)
+{
+	if (!Response || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		return false;
+	}
+
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	{
+		return false;
+	}
+
+	TArray<FString> Languages;
+	const TArray<TSharedPtr<FJsonValue>>* SelectedLanguages = nullptr;
+	if (JsonObject->TryGetArrayField(TEXT("selectedLanguages"), SelectedLanguages))
+	{
+		for (const TSharedPtr<FJsonValue>& Language : *SelectedLanguages)
+		{
+			Languages.Add(Language->AsObject()->GetStringField(TEXT("tag")));
+		}
+	}
+
+	// NOTE: Empty pages come without the _embedded object.
+	const TSharedPtr<FJsonObject>* Embedded = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Keys = nullptr;
+	if (!JsonObject->TryGetObjectField(TEXT("_embedded"), Embedded) || !(*Embedded)->TryGetArrayField(TEXT("keys"), Keys))
+	{
+		return true;
+	}
+
+	for (const TSharedPtr<FJsonValue>& KeyValue : *Keys)
+	{
+		const TSharedPtr<FJsonObject> KeyObject = KeyValue->AsObject();
+		const FString KeyName = KeyObject->GetStringField(TEXT("keyName"));
+
+		const TSharedPtr<FJsonObject>* Translations = nullptr;
+		KeyObject->TryGetObjectField(TEXT("translations"), Translations);
+
+		// NOTE: A language missing from the translations has no text anymore, which is stored as an empty change.
+		for (const FString& Language : Languages)
+		{
+			const TSharedPtr<FJsonObject>* Translation = nullptr;
+			FString Text;
+			if (Translations && (*Translations)->TryGetObjectField(Language, Translation))
+			{
+				(*Translation)->TryGetStringField(TEXT("text"), Text);
+			}
+
+			OutChanges.FindOrAdd(Language).Add(KeyName, Text);
+		}
+	}
+
+	OutNumKeys = Keys->Num();
+	JsonObject->TryGetStringField(TEXT("nextCursor"), OutNextCursor);
+	return true;
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnProjectDeltaRead(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const TMap<FString, TMap<FString, FString>>& Changes, bool bWasSuccessful, int32 Generation)
+{
+	check(IsInGameThread());
+
+	if (Generation != FetchGeneration)
+	{
+		return;
+	}
+
+	if (bWasSuccessful)
+	{
+		const TMap<FString, FTolgeeCultureIndexRef>* LiveCultures = ProjectTranslations.Find(ProjectId);
+		const TMap<FString, FTolgeeCultureIndexRef>* PendingCultures = PendingProjectTranslations.Find(ProjectId);
+
+		int32 NumPatchedKeys = 0;
+		for (const TPair<FString, TMap<FString, FString>>& Culture : Changes)
+		{
+			// NOTE: Patches are applied on top of the newest data we have for the project, staged or live.
+			const FTolgeeCultureIndexRef* Existing = PendingCultures ? PendingCultures->Find(Culture.Key) : nullptr;
+			Existing = Existing ? Existing : (LiveCultures ? LiveCultures->Find(Culture.Key) : nullptr);
+
+			OnCultureRead(ProjectId, Culture.Key, PatchCulture(Existing, Culture.Value), Generation);
+			NumPatchedKeys += Culture.Value.Num();
+		}
+
+		UE_LOG(LogTolgee, Display, TEXT("Delta sync patched %d translations in %d cultures for project %s."), NumPatchedKeys, Changes.Num(), *ProjectId);
+	}
+
+	OnProjectRead(ProjectId, LanguageUpdates, bWasSuccessful, Generation);
+}
+
+FTolgeeCultureIndexRef UTolgeeEditorIntegrationSubsystem::PatchCulture(const FTolgeeCultureIndexRef* Existing, const TMap<FString, FString>& Changes)
+{
+	FTolgeeCultureIndexBuilder Builder = Existing ? FTolgeeCultureIndexBuilder(*Existing) : FTolgeeCultureIndexBuilder();
+
+	for (const TPair<FString, FString>& Key : Changes)
+	{
+		const FTextId Id = MakeTextId(Key.Key);
+		if (Key.Value.IsEmpty())
+		{
+			Builder.Remove(Id);
+			continue;
+		}
+
+		// NOTE: The changes don't provide the source string, keys new to the project get the unknown hash and the injection uses the one of the live entry.
+		const int32 ExistingPosition = Existing ? (*Existing)->Find(Id) : INDEX_NONE;
+		const uint32 SourceStringHash = ExistingPosition != INDEX_NONE ? (*Existing)->GetSourceStringHash(ExistingPosition) : FTolgeeCultureIndex::UnknownSourceStringHash;
+		Builder.Add(Id, SourceStringHash, Key.Value);
+	}
+
+	return Builder.Build();
+}
+
+FTextId UTolgeeEditorIntegrationSubsystem::MakeTextId(const FString& KeyName)
+{
+	// NOTE: Keys are uploaded as "Namespace,Key", the same identity the PO exports use in msgctxt.
+	FString Namespace;
+	FString Key;
+	if (!KeyName.Split(TEXT(","), &Namespace, &Key))
+	{
+		Namespace = KeyName;
+	}
+
+	return FTextId(FTextKey(Namespace), FTextKey(Key));
+}
+
+void UTolgeeEditorIntegrationSubsystem::FetchFromDashboard(const FString& ProjectId, const FString& RequestUrl, const TMap<FString, FDateTime>& LanguageUpdates)
 {
 	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
 
@@ -75,114 +598,333 @@ void UTolgeeEditorIntegrationSubsystem::FetchFromDashboard(const FString& Projec
 	HttpRequest->SetHeader(TEXT("X-API-Key"), Settings->ApiKey);
 	TolgeeUtils::AddSdkHeaders(HttpRequest);
 
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedFromDashboard, ProjectId);
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ThisClass::OnFetchedFromDashboard, ProjectId, LanguageUpdates);
 	HttpRequest->ProcessRequest();
 
 	NumRequestsSent++;
 }
 
-void UTolgeeEditorIntegrationSubsystem::OnFetchedFromDashboard(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString ProjectId)
+void UTolgeeEditorIntegrationSubsystem::OnFetchedFromDashboard(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString ProjectId, TMap<FString, FDateTime> LanguageUpdates)
 {
 	if (bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 	{
 		UE_LOG(LogTolgee, Display, TEXT("Fetch successfully for %s to %s."), *ProjectId, *Request->GetURL());
-		ReadTranslationsFromZipContent(ProjectId, Response->GetContent());
+
+		// NOTE: The archive is read straight from the response on the task graph, every culture is staged as soon as it's parsed.
+		AsyncTask(
+			ENamedThreads::AnyBackgroundThreadNormalTask,
+			[WeakThis = TWeakObjectPtr<ThisClass>(this), Response, ProjectId, LanguageUpdates, Generation = FetchGeneration]()
+			{
+				const bool bReadSuccess = ReadTranslationsFromZipContent(ProjectId, Response->GetContent(),
+				                                                         [WeakThis, ProjectId, Generation](const FString& Culture, const FTolgeeCultureIndexRef& Translations)
+				                                                         {
+					                                                         AsyncTask(ENamedThreads::GameThread,
+					                                                                   [WeakThis, ProjectId, Generation, Culture, Translations]()
+					                                                                   {
+						                                                                   if (WeakThis.IsValid())
+						                                                                   {
+							                                                                   WeakThis->OnCultureRead(ProjectId, Culture, Translations, Generation);
+						                                                                   }
+					                                                                   });
+				                                                         });
+
+				AsyncTask(ENamedThreads::GameThread,
+				          [WeakThis, ProjectId, LanguageUpdates, bReadSuccess, Generation]()
+				          {
+					          if (WeakThis.IsValid())
+					          {
+						          WeakThis->OnProjectRead(ProjectId, LanguageUpdates, bReadSuccess, Generation);
+					          }
+				          });
+			}
+		);
+		return;
+	}
+
+	UE_LOG(LogTolgee, Error, TEXT("Request for %s to %s failed."), *ProjectId, *Request->GetURL());
+
+	OnProjectRead(ProjectId, LanguageUpdates, false, FetchGeneration);
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnProjectRead(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, bool bWasSuccessful, int32 Generation)
+{
+	check(IsInGameThread());
+
+	if (Generation != FetchGeneration)
+	{
+		return;
+	}
+
+	// NOTE: Timestamps are only stored together with the data they describe, so failed exports are retried on the next check.
+	if (bWasSuccessful)
+	{
+		PendingLanguageUpdates.FindOrAdd(ProjectId).Append(LanguageUpdates);
 	}
 	else
 	{
-		UE_LOG(LogTolgee, Error, TEXT("Request for %s to %s failed."), *ProjectId, *Request->GetURL());
+		// NOTE: The failed request might have been the full export of the project, the next check exports it again.
+		FullyExportedProjects.Remove(ProjectId);
+		bHasFailedRequests = true;
 	}
 
 	NumRequestsCompleted++;
 
 	if (NumRequestsCompleted == NumRequestsSent)
 	{
-		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Refreshing translation data."));
-		RefreshTranslationDataAsync();
+		OnAllRequestsCompleted();
 	}
 }
 
-void UTolgeeEditorIntegrationSubsystem::ResetData()
+void UTolgeeEditorIntegrationSubsystem::OnAllRequestsCompleted()
 {
-	NumRequestsSent = 0;
-	NumRequestsCompleted = 0;
+	if (bHasFailedRequests)
+	{
+		UE_LOG(LogTolgee, Warning, TEXT("Some requests failed. Keeping the previous translation data, the failed languages will be fetched again on the next check."));
+	}
+	else
+	{
+		UE_LOG(LogTolgee, Display, TEXT("All requests completed. Swapping in the new translation data."));
+		ApplyProjectTranslations(PendingProjectTranslations);
 
-	CachedTranslations.Empty();
-	LastFetchTime = {0};
+		for (const TPair<FString, TMap<FString, FDateTime>>& Project : PendingLanguageUpdates)
+		{
+			LanguageUpdateTimes.FindOrAdd(Project.Key).Append(Project.Value);
+		}
+		ProjectFetchTimes.Append(PendingFetchTimes);
+
+		TArray<FString> UpdatedProjects;
+		PendingProjectTranslations.GetKeys(UpdatedProjects);
+		SaveProjectsToCache(UpdatedProjects);
+	}
+
+	PendingProjectTranslations.Empty();
+	PendingLanguageUpdates.Empty();
+	PendingFetchTimes.Empty();
+	bHasFailedRequests = false;
+
+	OnUpdateCheckCompleted();
 }
 
-bool UTolgeeEditorIntegrationSubsystem::ReadTranslationsFromZipContent(const FString& ProjectId, const TArray<uint8>& ResponseContent)
+void UTolgeeEditorIntegrationSubsystem::SaveProjectsToCache(const TArray<FString>& ProjectIds)
 {
-	static FCriticalSection ReadFromFileCriticalSection;
-	FScopeLock Lock(&ReadFromFileCriticalSection);
+	const uint32 SaveId = TolgeeEditorCache::MakeSaveId();
 
-	const FString TempPath = FPaths::ProjectSavedDir() / TEXT("Tolgee") / TEXT("In-Context") / ProjectId + TEXT(".zip");
-	const bool bSaveSuccess = FFileHelper::SaveArrayToFile(ResponseContent, *TempPath);
-	if (!bSaveSuccess)
+	TArray<TTuple<FString, FTolgeeEditorProjectCache, TSet<FString>>> Projects;
+	for (const FString& ProjectId : ProjectIds)
 	{
-		UE_LOG(LogTolgee, Error, TEXT("Failed to save zip for project %s as file to %s"), *ProjectId, *TempPath);
-		return false;
+		// NOTE: The cultures of the saves still in flight are written again, so the save can't be undone by an older one it makes outdated.
+		TSet<FString> ChangedCultures;
+		for (TPair<FString, uint32>& Culture : UnsavedCultures.FindOrAdd(ProjectId))
+		{
+			ChangedCultures.Add(Culture.Key);
+			Culture.Value = SaveId;
+		}
+
+		FTolgeeEditorProjectCache Project;
+		Project.Cultures = ProjectTranslations.FindRef(ProjectId);
+		Project.LanguageUpdateTimes = LanguageUpdateTimes.FindRef(ProjectId);
+		Project.FetchTime = ProjectFetchTimes.FindRef(ProjectId);
+		Projects.Emplace(ProjectId, MoveTemp(Project), MoveTemp(ChangedCultures));
 	}
 
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	// NOTE: The indexes are immutable once built, so sharing them with the writer is safe.
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakObjectPtr<ThisClass>(this), Projects = MoveTemp(Projects), SaveId]()
+	{
+		for (const TTuple<FString, FTolgeeEditorProjectCache, TSet<FString>>& Project : Projects)
+		{
+			if (!TolgeeEditorCache::Save(Project.Get<0>(), Project.Get<1>(), Project.Get<2>(), SaveId))
+			{
+				continue;
+			}
 
-	IFileHandle* ArchiveFileHandle = PlatformFile.OpenRead(*TempPath);
-	FZipArchiveReader ZipReader = {ArchiveFileHandle};
-	if (!ZipReader.IsValid())
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, ProjectId = Project.Get<0>(), SaveId]()
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->OnProjectSavedToCache(ProjectId, SaveId);
+				}
+			});
+		}
+	});
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnProjectSavedToCache(const FString& ProjectId, uint32 SaveId)
+{
+	TMap<FString, uint32>* Cultures = UnsavedCultures.Find(ProjectId);
+	if (!Cultures)
 	{
-		UE_LOG(LogTolgee, Error, TEXT("Failed to open zip for project %s located at %s"), *ProjectId, *TempPath);
-		return false;
+		return;
 	}
 
-	const TArray<FString> FileNames = ZipReader.GetFileNames();
-	for (const FString& FileName : FileNames)
+	// NOTE: Cultures changed again after the save started are still pending.
+	for (auto It = Cultures->CreateIterator(); It; ++It)
+	{
+		if (It->Value != 0 && It->Value <= SaveId)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnCultureRead(const FString& ProjectId, const FString& Culture, const FTolgeeCultureIndexRef& Translations, int32 Generation)
+{
+	check(IsInGameThread());
+
+	if (Generation != FetchGeneration)
+	{
+		UE_LOG(LogTolgee, Verbose, TEXT("Discarding translations for %s read for a previous fetch."), *Culture);
+		return;
+	}
+
+	// NOTE: Cultures that have data are only swapped once every request succeeded, so the injected text never regresses to a partial set.
+	// Cultures without any data yet have nothing to regress to, so they are injected right away.
+	if (!CachedTranslations.Contains(Culture))
+	{
+		TMap<FString, TMap<FString, FTolgeeCultureIndexRef>> NewTranslations;
+		NewTranslations.FindOrAdd(ProjectId).Emplace(Culture, Translations);
+		ApplyProjectTranslations(NewTranslations);
+	}
+
+	PendingProjectTranslations.FindOrAdd(ProjectId).Emplace(Culture, Translations);
+}
+
+void UTolgeeEditorIntegrationSubsystem::ApplyProjectTranslations(const TMap<FString, TMap<FString, FTolgeeCultureIndexRef>>& Translations)
+{
+	if (Translations.IsEmpty())
+	{
+		return;
+	}
+
+	// NOTE: The project's previous data for each culture is replaced, so keys deleted on the dashboard disappear as well.
+	for (const TPair<FString, TMap<FString, FTolgeeCultureIndexRef>>& Project : Translations)
 	{
-		TArray<uint8> FileBuffer;
-		if (ZipReader.TryReadFile(FileName, FileBuffer))
+		for (const TPair<FString, FTolgeeCultureIndexRef>& Culture : Project.Value)
 		{
-			const FString InCulture = FPaths::GetBaseFilename(FileName);
-			const FString FileContents = FString(FileBuffer.Num(), UTF8_TO_TCHAR(FileBuffer.GetData()));
+			ProjectTranslations.FindOrAdd(Project.Key).Emplace(Culture.Key, Culture.Value);
+			UnsavedCultures.FindOrAdd(Project.Key).Emplace(Culture.Key, 0);
+		}
+	}
+
+	LayerProjectTranslations(Translations);
+
+	PublishTranslations(CachedTranslations);
+	QueueRefresh();
+}
 
-			TArray<FTolgeeTranslationData> Translations = ExtractTranslationsFromPO(FileContents);
-			CachedTranslations.FindOrAdd(InCulture).Append(Translations);
+void UTolgeeEditorIntegrationSubsystem::LayerProjectTranslations(const TMap<FString, TMap<FString, FTolgeeCultureIndexRef>>& Translations)
+{
+	const TArray<FString>& ProjectIds = GetDefault<UTolgeeEditorSettings>()->ProjectIds;
+
+	// NOTE: Layers can't be moved or removed, so a change of the configured projects (or their order) lays out every project again.
+	const TMap<FString, TMap<FString, FTolgeeCultureIndexRef>>* ProjectsToLayer = &Translations;
+	if (LayeredProjectIds != ProjectIds)
+	{
+		LayeredCultures.Empty();
+		LayeredProjectIds = ProjectIds;
+		ProjectsToLayer = &ProjectTranslations;
+	}
+
+	for (const TPair<FString, TMap<FString, FTolgeeCultureIndexRef>>& Project : *ProjectsToLayer)
+	{
+		const int32 Layer = LayeredProjectIds.IndexOfByKey(Project.Key);
+		if (Layer == INDEX_NONE)
+		{
+			continue;
 		}
-		else
+
+		for (const TPair<FString, FTolgeeCultureIndexRef>& Culture : Project.Value)
 		{
-			UE_LOG(LogTolgee, Warning, TEXT("Failed to read file %s for project %s inside zip at %s"), *FileName, *ProjectId, *TempPath);
+			LayeredCultures.FindOrAdd(Culture.Key).SetLayer(Layer, Culture.Value);
 		}
 	}
 
-	return true;
+	CachedTranslations.Reset();
+	for (const TPair<FString, FTolgeeLayeredCultureIndex>& Culture : LayeredCultures)
+	{
+		CachedTranslations.Emplace(Culture.Key, Culture.Value.GetMerged());
+	}
 }
 
-void UTolgeeEditorIntegrationSubsystem::OnRefreshTick()
+void UTolgeeEditorIntegrationSubsystem::ResetData()
 {
-	FetchIUpdatesAreAvailableAsync();
+	check(IsInGameThread());
+
+	NumRequestsSent = 0;
+	NumRequestsCompleted = 0;
+	FetchGeneration++;
+
+	// NOTE: ProjectTranslations and the update times stay warm, the next session injects them right away and only revalidates them.
+	PendingProjectTranslations.Empty();
+	PendingLanguageUpdates.Empty();
+	PendingFetchTimes.Empty();
+	bHasFailedRequests = false;
+	bRequestInProgress = false;
+	bUpdateCheckQueued = false;
+	CachedTranslations.Empty();
+	PublishTranslations(CachedTranslations);
 }
 
-void UTolgeeEditorIntegrationSubsystem::FetchIUpdatesAreAvailableAsync()
+bool UTolgeeEditorIntegrationSubsystem::ReadTranslationsFromZipContent(const FString& ProjectId, TConstArrayView<uint8> ResponseContent, TFunctionRef<void(const FString&, const FTolgeeCultureIndexRef&)> OnCultureParsed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTolgeeEditorIntegrationSubsystem::ReadTranslationsFromZipContent)
+
+	// NOTE: The reader takes ownership of the handle.
+	FZipArchiveReader ZipReader = {new FTolgeeMemoryFileHandle(ResponseContent)};
+	if (!ZipReader.IsValid())
+	{
+		UE_LOG(LogTolgee, Error, TEXT("Failed to open zip for project %s"), *ProjectId);
+		return false;
+	}
+
+	// NOTE: A zip reader seeks through its handle, so every task opens its own reader over the shared response buffer.
+	const TArray<FString> FileNames = ZipReader.GetFileNames();
+	TAtomic<bool> bReadAllFiles = true;
+	ParallelFor(FileNames.Num(),
+	            [&](int32 FileIndex)
+	            {
+		            const FString& FileName = FileNames[FileIndex];
+
+		            FZipArchiveReader EntryReader = {new FTolgeeMemoryFileHandle(ResponseContent)};
+		            TArray<uint8> FileBuffer;
+		            if (EntryReader.IsValid() && EntryReader.TryReadFile(FileName, FileBuffer))
+		            {
+			            const FString InCulture = FPaths::GetBaseFilename(FileName);
+			            OnCultureParsed(InCulture, ExtractTranslationsFromPO(FileBuffer));
+		            }
+		            else
+		            {
+			            UE_LOG(LogTolgee, Warning, TEXT("Failed to read file %s inside zip for project %s"), *FileName, *ProjectId);
+			            bReadAllFiles = false;
+		            }
+	            });
+
+	return bReadAllFiles;
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnRefreshTick()
 {
-	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask,
-	          [this]()
-	          {
-		          FetchIfProjectsWereUpdated();
-	          });
+	if (bLiveUpdatesConnected)
+	{
+		return;
+	}
+
+	FetchIUpdatesAreAvailableAsync();
 }
 
-void UTolgeeEditorIntegrationSubsystem::FetchIfProjectsWereUpdated()
+void UTolgeeEditorIntegrationSubsystem::FetchIUpdatesAreAvailableAsync()
 {
 	if (bRequestInProgress)
 	{
 		return;
 	}
 
-	TGuardValue ScopedRequestProgress(bRequestInProgress, true);
+	bRequestInProgress = true;
 
-	FDateTime LastProjectUpdate = {0};
-	TArray<FHttpRequestPtr> PendingRequests;
+	TArray<TFuture<FHttpResponsePtr>> PendingResponses;
 	const UTolgeeEditorSettings* Settings = GetDefault<UTolgeeEditorSettings>();
+	const TArray<FString> ProjectIds = Settings->ProjectIds;
 
-	for (const FString& ProjectId : Settings->ProjectIds)
+	for (const FString& ProjectId : ProjectIds)
 	{
 		const FString RequestUrl = FString::Printf(TEXT("%s/v2/projects/%s/stats"), *Settings->GetBaseUrl(), *ProjectId);
 
@@ -192,53 +934,135 @@ void UTolgeeEditorIntegrationSubsystem::FetchIfProjectsWereUpdated()
 		HttpRequest->SetHeader(TEXT("X-API-Key"), Settings->ApiKey);
 		TolgeeUtils::AddSdkHeaders(HttpRequest);
 
-		HttpRequest->ProcessRequest();
+		PendingResponses.Add(TolgeeUtils::ProcessRequestAsync(HttpRequest));
+	}
+
+	// NOTE: Nothing waits for the responses, the continuation runs on the game thread once the last request completes.
+	TolgeeUtils::WhenAll(MoveTemp(PendingResponses)).Next([WeakThis = TWeakObjectPtr<ThisClass>(this), ProjectIds, Generation = FetchGeneration](TArray<FHttpResponsePtr> Responses)
+	{
+		if (!WeakThis.IsValid() || Generation != WeakThis->FetchGeneration)
+		{
+			return;
+		}
 
-		PendingRequests.Add(HttpRequest);
+		WeakThis->OnProjectsUpdateChecked(ProjectIds, Responses);
+
+		// NOTE: The check stays in progress while the exports it started are running, otherwise a slow export would be requested again by the next check.
+		if (WeakThis->NumRequestsCompleted == WeakThis->NumRequestsSent)
+		{
+			WeakThis->OnUpdateCheckCompleted();
+		}
+	});
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnUpdateCheckCompleted()
+{
+	check(IsInGameThread());
+
+	if (!bRequestInProgress)
+	{
+		return;
+	}
+
+	bRequestInProgress = false;
+
+	// NOTE: Events received while checking might describe changes the stats didn't include yet.
+	if (bUpdateCheckQueued)
+	{
+		bUpdateCheckQueued = false;
+		FetchIUpdatesAreAvailableAsync();
 	}
+}
 
+TMap<FString, FDateTime> UTolgeeEditorIntegrationSubsystem::GetLanguageUpdateTimes(const FHttpResponsePtr& Response)
+{
+	TMap<FString, FDateTime> Result;
 
-	while (!PendingRequests.IsEmpty())
+	if (!Response || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 	{
-		FPlatformProcess::Sleep(0.1f);
+		return Result;
+	}
+
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedPtr<FJsonObject> JsonObject;
 
-		for (auto RequestIt = PendingRequests.CreateIterator(); RequestIt; ++RequestIt)
+	if (FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	{
+		const TArray<TSharedPtr<FJsonValue>> LanguageStats = JsonObject->GetArrayField(TEXT("languageStats"));
+		for (const TSharedPtr<FJsonValue>& Language : LanguageStats)
 		{
-			const FHttpRequestPtr& Request = *RequestIt;
-			if (EHttpRequestStatus::IsFinished(Request->GetStatus()))
-			{
-				const FHttpResponsePtr Response = Request->GetResponse();
-				if (Response && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
-				{
-					const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-					TSharedPtr<FJsonObject> JsonObject;
-
-					if (FJsonSerializer::Deserialize(JsonReader, JsonObject))
-					{
-						const TArray<TSharedPtr<FJsonValue>> LanguageStats = JsonObject->GetArrayField(TEXT("languageStats"));
-						for (const TSharedPtr<FJsonValue>& Language : LanguageStats)
-						{
-							const double LanguageUpdateTime = Language->AsObject()->GetNumberField(TEXT("translationsUpdatedAt"));
-							const int64 UnixTimestampSeconds = LanguageUpdateTime / 1000;
-							const FDateTime UpdateTime = FDateTime::FromUnixTimestamp(UnixTimestampSeconds);
-
-							LastProjectUpdate = LastProjectUpdate < UpdateTime ? UpdateTime : LastProjectUpdate;
-						}
-					}
-				}
+			const TSharedPtr<FJsonObject> LanguageObject = Language->AsObject();
+			const FString LanguageTag = LanguageObject->GetStringField(TEXT("languageTag"));
+			const double LanguageUpdateTime = LanguageObject->GetNumberField(TEXT("translationsUpdatedAt"));
+
+			// NOTE: Millisecond precision is kept, so two edits made within the same second are still told apart.
+			const FDateTime UpdateTime = FDateTime::FromUnixTimestamp(0) + FTimespan::FromMilliseconds(LanguageUpdateTime);
 
-				RequestIt.RemoveCurrent();
+			if (!LanguageTag.IsEmpty())
+			{
+				Result.Add(LanguageTag, UpdateTime);
 			}
 		}
 	}
 
-	if (LastProjectUpdate > LastFetchTime)
-	{
-		ResetData();
-		FetchAllProjects();
-	}
-	else
+	return Result;
+}
+
+void UTolgeeEditorIntegrationSubsystem::OnProjectsUpdateChecked(const TArray<FString>& ProjectIds, const TArray<FHttpResponsePtr>& Responses)
+{
+	check(IsInGameThread());
+
+	for (int32 ProjectIndex = 0; ProjectIndex < ProjectIds.Num(); ++ProjectIndex)
 	{
-		UE_LOG(LogTolgee, Display, TEXT("No new updates since last fetch at %s, last project update was at %s"), *LastFetchTime.ToString(), *LastProjectUpdate.ToString());
+		const FString& ProjectId = ProjectIds[ProjectIndex];
+		TMap<FString, FDateTime>& KnownUpdateTimes = LanguageUpdateTimes.FindOrAdd(ProjectId);
+
+		const TMap<FString, FDateTime> LanguageStats = GetLanguageUpdateTimes(Responses[ProjectIndex]);
+
+		TMap<FString, FDateTime> ChangedLanguages;
+		FDateTime RevisedAfter = FDateTime::MaxValue();
+		for (const TPair<FString, FDateTime>& Language : LanguageStats)
+		{
+			// NOTE: Languages we never saw a timestamp for are compared to the last full fetch of the project.
+			const FDateTime* KnownUpdateTime = KnownUpdateTimes.Find(Language.Key);
+			const FDateTime PreviousUpdateTime = KnownUpdateTime ? *KnownUpdateTime : ProjectFetchTimes.FindRef(ProjectId);
+
+			if (Language.Value > PreviousUpdateTime)
+			{
+				ChangedLanguages.Add(Language.Key, Language.Value);
+				RevisedAfter = FMath::Min(RevisedAfter, PreviousUpdateTime);
+			}
+			else if (!KnownUpdateTime)
+			{
+				KnownUpdateTimes.Add(Language.Key, Language.Value);
+			}
+		}
+
+		// NOTE: Delta sync patches the data we already have, so the first fetch of a project is always a full export.
+		const bool bUseDeltaSync = GetDefault<UTolgeeEditorSettings>()->bUseDeltaSync && ProjectTranslations.Contains(ProjectId);
+
+		// NOTE: Data loaded from the disk cache might still contain keys deleted since it was written, which the delta never lists, so every language is exported once after loading it.
+		if (bUseDeltaSync && !FullyExportedProjects.Contains(ProjectId) && !LanguageStats.IsEmpty())
+		{
+			UE_LOG(LogTolgee, Display, TEXT("Exporting every language of project %s once this session to drop the deleted keys."), *ProjectId);
+			FullyExportedProjects.Add(ProjectId);
+			FetchProjectLanguages(ProjectId, LanguageStats);
+			continue;
+		}
+
+		if (ChangedLanguages.IsEmpty())
+		{
+			UE_LOG(LogTolgee, Display, TEXT("No new updates for project %s."), *ProjectId);
+			continue;
+		}
+
+		if (bUseDeltaSync)
+		{
+			FetchProjectDelta(ProjectId, ChangedLanguages, RevisedAfter);
+		}
+		else
+		{
+			FetchProjectLanguages(ProjectId, ChangedLanguages);
+		}
 	}
 }
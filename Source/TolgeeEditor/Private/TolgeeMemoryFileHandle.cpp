@@ -0,0 +1,61 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeMemoryFileHandle.h"
+
+FTolgeeMemoryFileHandle::FTolgeeMemoryFileHandle(TConstArrayView<uint8> InBuffer) :
+	Buffer(InBuffer)
+{
+}
+
+int64 FTolgeeMemoryFileHandle::Tell()
+{
+	return Position;
+}
+
+bool FTolgeeMemoryFileHandle::Seek(int64 NewPosition)
+{
+	if (NewPosition < 0 || NewPosition > Buffer.Num())
+	{
+		return false;
+	}
+
+	Position = NewPosition;
+	return true;
+}
+
+bool FTolgeeMemoryFileHandle::SeekFromEnd(int64 NewPositionRelativeToEnd)
+{
+	return Seek(Buffer.Num() + NewPositionRelativeToEnd);
+}
+
+bool FTolgeeMemoryFileHandle::Read(uint8* Destination, int64 BytesToRead)
+{
+	if (BytesToRead < 0 || BytesToRead > Buffer.Num() - Position)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Destination, Buffer.GetData() + Position, BytesToRead);
+	Position += BytesToRead;
+	return true;
+}
+
+bool FTolgeeMemoryFileHandle::Write(const uint8* Source, int64 BytesToWrite)
+{
+	return false;
+}
+
+bool FTolgeeMemoryFileHandle::Flush(const bool bFullFlush)
+{
+	return true;
+}
+
+bool FTolgeeMemoryFileHandle::Truncate(int64 NewSize)
+{
+	return false;
+}
+
+int64 FTolgeeMemoryFileHandle::Size()
+{
+	return Buffer.Num();
+}
@@ -0,0 +1,174 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#include "TolgeeStompClient.h"
+
+#include <IWebSocket.h>
+#include <WebSocketsModule.h>
+
+#include "TolgeeLog.h"
+
+void FTolgeeStompClient::Connect(const FString& Url, const TMap<FString, FString>& ConnectHeaders)
+{
+	Close();
+
+	PendingConnectHeaders = ConnectHeaders;
+	PendingConnectHeaders.Add(TEXT("accept-version"), TEXT("1.2"));
+	PendingConnectHeaders.Add(TEXT("heart-beat"), TEXT("0,0"));
+
+	WebSocket = FWebSocketsModule::Get().CreateWebSocket(Url, TEXT("v12.stomp"));
+	WebSocket->OnConnected().AddSP(this, &FTolgeeStompClient::OnSocketConnected);
+	WebSocket->OnRawMessage().AddSP(this, &FTolgeeStompClient::OnSocketMessage);
+	WebSocket->OnConnectionError().AddSP(this, &FTolgeeStompClient::OnSocketConnectionError);
+	WebSocket->OnClosed().AddSP(this, &FTolgeeStompClient::OnSocketClosed);
+	WebSocket->Connect();
+}
+
+void FTolgeeStompClient::Subscribe(const FString& Destination)
+{
+	TMap<FString, FString> Headers;
+	Headers.Add(TEXT("id"), FString::Printf(TEXT("sub-%d"), NextSubscriptionId++));
+	Headers.Add(TEXT("destination"), Destination);
+	SendFrame(TEXT("SUBSCRIBE"), Headers);
+}
+
+void FTolgeeStompClient::Close()
+{
+	if (!WebSocket)
+	{
+		return;
+	}
+
+	// NOTE: Callbacks are unbound first, so closing on purpose doesn't look like a dropped connection.
+	WebSocket->OnConnected().RemoveAll(this);
+	WebSocket->OnRawMessage().RemoveAll(this);
+	WebSocket->OnConnectionError().RemoveAll(this);
+	WebSocket->OnClosed().RemoveAll(this);
+	WebSocket->Close();
+	WebSocket.Reset();
+
+	ReceiveBuffer.Reset();
+	NextSubscriptionId = 0;
+}
+
+void FTolgeeStompClient::OnSocketConnected()
+{
+	SendFrame(TEXT("CONNECT"), PendingConnectHeaders);
+}
+
+void FTolgeeStompClient::OnSocketMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+	// NOTE: Handling the frame might close the connection, the socket has to outlive the callback it's executing.
+	const TSharedPtr<IWebSocket> KeepAlive = WebSocket;
+
+	// NOTE: Raw bytes are used because frames are delimited by a null byte, which doesn't survive the conversion to FString.
+	ReceiveBuffer.Append(static_cast<const uint8*>(Data), Size);
+
+	int32 FrameEnd = INDEX_NONE;
+	while (ReceiveBuffer.Find(0, FrameEnd))
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(ReceiveBuffer.GetData()), FrameEnd);
+		const FString Frame(Converted.Length(), Converted.Get());
+		ReceiveBuffer.RemoveAt(0, FrameEnd + 1);
+
+		HandleFrame(Frame);
+		if (!WebSocket)
+		{
+			return;
+		}
+	}
+}
+
+void FTolgeeStompClient::OnSocketConnectionError(const FString& Error)
+{
+	const TSharedPtr<IWebSocket> KeepAlive = WebSocket;
+	NotifyClosed(Error);
+}
+
+void FTolgeeStompClient::OnSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+	const TSharedPtr<IWebSocket> KeepAlive = WebSocket;
+	NotifyClosed(FString::Printf(TEXT("%d %s"), StatusCode, *Reason));
+}
+
+void FTolgeeStompClient::HandleFrame(const FString& Frame)
+{
+	// NOTE: Heart-beats (and the line feeds between frames) show up as empty lines before the command.
+	FString Remaining = Frame.TrimStart();
+	if (Remaining.IsEmpty())
+	{
+		return;
+	}
+
+	FString Head;
+	FString Body;
+	if (!Remaining.Split(TEXT("\n\n"), &Head, &Body))
+	{
+		Head = Remaining;
+	}
+
+	TArray<FString> Lines;
+	Head.ParseIntoArrayLines(Lines);
+	if (Lines.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Command = Lines[0].TrimEnd();
+	TMap<FString, FString> Headers;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		FString Name;
+		FString Value;
+		if (Lines[LineIndex].Split(TEXT(":"), &Name, &Value))
+		{
+			// NOTE: Repeated headers keep their first value as required by the spec.
+			if (!Headers.Contains(Name))
+			{
+				Headers.Add(Name, Value.TrimEnd());
+			}
+		}
+	}
+
+	if (Command == TEXT("CONNECTED"))
+	{
+		UE_LOG(LogTolgee, Display, TEXT("Live updates connected."));
+		OnConnected.ExecuteIfBound();
+	}
+	else if (Command == TEXT("MESSAGE"))
+	{
+		OnMessage.ExecuteIfBound(Headers.FindRef(TEXT("destination")), Body);
+	}
+	else if (Command == TEXT("ERROR"))
+	{
+		NotifyClosed(FString::Printf(TEXT("%s %s"), *Headers.FindRef(TEXT("message")), *Body));
+	}
+}
+
+void FTolgeeStompClient::SendFrame(const FString& Command, const TMap<FString, FString>& Headers)
+{
+	if (!WebSocket || !WebSocket->IsConnected())
+	{
+		return;
+	}
+
+	FString Frame = Command + TEXT("\n");
+	for (const TPair<FString, FString>& Header : Headers)
+	{
+		Frame.Appendf(TEXT("%s:%s\n"), *Header.Key, *Header.Value);
+	}
+	Frame.AppendChar(TEXT('\n'));
+
+	// NOTE: Frames end with a null byte, so the payload is sent as raw UTF-8 in a text message.
+	const FTCHARToUTF8 Converted(*Frame);
+	TArray<uint8> Payload(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	Payload.Add(0);
+	WebSocket->Send(Payload.GetData(), Payload.Num(), false);
+}
+
+void FTolgeeStompClient::NotifyClosed(const FString& Reason)
+{
+	UE_LOG(LogTolgee, Warning, TEXT("Live updates connection closed: %s"), *Reason);
+
+	Close();
+	OnClosed.ExecuteIfBound(Reason);
+}
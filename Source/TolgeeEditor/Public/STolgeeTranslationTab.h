@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <Async/Future.h>
+#include <Interfaces/IHttpRequest.h>
 #include <Widgets/Docking/SDockTab.h>
 
 class UCanvas;
@@ -44,11 +46,15 @@ private:
 	/**
 	 * Updates the browser widget to display the Tolgee web editor for the given key.
 	 */
-	void ShowWidgetFor(const FString& TolgeeKeyId);
+	void ShowWidgetFor(const FString& TolgeeKeyId, const FString& ProjectId);
 	/**
-	 * Finds the project id for the given TolgeeKeyId.
+	 * Finds the project id for the given TolgeeKeyId. The future is fulfilled with an empty string if no project contains it.
 	 */
-	FString FindProjectIdFor(const FString& TolgeeKeyId) const;
+	TFuture<FString> FindProjectIdForAsync(const FString& TolgeeKeyId) const;
+	/**
+	 * Checks if a translations search response contains any key.
+	 */
+	static bool ContainsKey(const FHttpResponsePtr& Response);
 	/**
 	 * @brief Handle for the registered debug callback
 	 */
@@ -0,0 +1,34 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Commandlets/Commandlet.h>
+
+#include "TolgeeCdnCache.h"
+
+#include "TolgeeBakeCdnDataCommandlet.generated.h"
+
+/**
+ * Downloads the current CDN data of every configured culture and bakes it into the binary cache format under Content/Tolgee/Baked.
+ * Run it before cooking (e.g. UnrealEditor-Cmd Project.uproject -run=TolgeeBakeCdnData) so the packaged build starts from a recent baseline
+ * and the runtime fetcher only revalidates it. The baked directory has to be listed in DirectoriesToAlwaysStageAsUFS.
+ * Optional parameters: -cultures=en,de to limit the cultures and -output=<Directory> to bake somewhere else.
+ */
+UCLASS()
+class UTolgeeBakeCdnDataCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UTolgeeBakeCdnDataCommandlet();
+
+	// ~ Begin UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// ~ End UCommandlet interface
+
+private:
+	/**
+	 * Downloads a single file, parses it and writes it into the output directory.
+	 */
+	bool BakeFile(const FTolgeeCdnCacheEntry& File, const FString& OutputDirectory) const;
+};
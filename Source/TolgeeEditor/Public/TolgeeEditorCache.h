@@ -0,0 +1,54 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <Containers/Set.h>
+#include <Misc/DateTime.h>
+
+#include "TolgeeCultureIndex.h"
+
+/**
+ * Dashboard data of a single project, persisted between editor sessions so PIE can inject it before any request completes.
+ */
+struct FTolgeeEditorProjectCache
+{
+	/**
+	 * Translations of the project, per culture.
+	 */
+	TMap<FString, FTolgeeCultureIndexRef> Cultures;
+	/**
+	 * Last translation update of every language the cultures above include.
+	 */
+	TMap<FString, FDateTime> LanguageUpdateTimes;
+	/**
+	 * Last time the project was fully fetched, used for the languages without an update time.
+	 */
+	FDateTime FetchTime = {0};
+};
+
+/**
+ * Disk cache of the projects fetched from the Tolgee dashboard, stored under Saved/Tolgee/In-Context/<ProjectId>.
+ * Every culture uses the binary index format and a project.json lists the cultures (tagged with the hash of their file) and the update times.
+ */
+namespace TolgeeEditorCache
+{
+	/**
+	 * @brief Directory holding the cached projects
+	 */
+	FString GetCacheDirectory();
+	/**
+	 * @brief Identifies a new snapshot of the projects, taken on the thread producing the snapshots so the identifiers follow their order
+	 */
+	uint32 MakeSaveId();
+	/**
+	 * @brief Writes the project to disk, the cultures first and the description last so a partial write is never loaded. Safe to call from any thread.
+	 * Only the changed cultures are written, the others keep the files of the previous save (or are written if it didn't include them).
+	 * Snapshots older than the one written last for the project are dropped, so saves running out of order never overwrite newer data.
+	 */
+	bool Save(const FString& ProjectId, const FTolgeeEditorProjectCache& Project, const TSet<FString>& ChangedCultures, uint32 SaveId);
+	/**
+	 * @brief Loads a project written by Save. Fails if the project is missing, corrupted or was fetched from a different Tolgee instance.
+	 */
+	bool Load(const FString& ProjectId, FTolgeeEditorProjectCache& OutProject);
+} // namespace TolgeeEditorCache
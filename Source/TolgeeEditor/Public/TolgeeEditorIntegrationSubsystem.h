@@ -4,11 +4,16 @@
 
 #include "TolgeeLocalizationInjectorSubsystem.h"
 
+#include <Containers/Ticker.h>
 #include <Engine/TimerHandle.h>
 #include <Interfaces/IHttpRequest.h>
 
+#include "TolgeeLayeredCultureIndex.h"
+
 #include "TolgeeEditorIntegrationSubsystem.generated.h"
 
+class FTolgeeStompClient;
+
 /**
  * Subsystem responsible for fetching localization data directly from the Tolgee dashboard (without exporting or CDN publishing).
  */
@@ -24,48 +29,194 @@ public:
 	void ManualFetch();
 
 private:
+	friend class FTolgeeEditorDeltaSyncTest;
+	friend class FTolgeeEditorDeltaSyncSessionsTest;
+	friend class FTolgeeEditorFailedExportTest;
+	friend class FTolgeeEditorLiveUpdatesTest;
+	friend class FTolgeeTestEditorSubsystem;
+
 	// ~ Begin UTolgeeLocalizationInjectorSubsystem interface
 	virtual void OnGameInstanceStart(UGameInstance* GameInstance) override;
 	virtual void OnGameInstanceEnd(bool bIsSimulating) override;
-	virtual TMap<FString, TArray<FTolgeeTranslationData>> GetDataToInject() const override;
 	// ~ End UTolgeeLocalizationInjectorSubsystem interface
 
+	/**
+	 * Injects the data we already have and starts revalidating it, at the start of every session.
+	 */
+	void BeginSession();
+	/**
+	 * Opens the WebSocket connection used to receive the translation change events of every project.
+	 */
+	void ConnectLiveUpdates();
+	/**
+	 * Opens the live updates connection to the given STOMP endpoint.
+	 */
+	void ConnectLiveUpdates(const FString& Url);
+	/**
+	 * Closes the live updates connection and cancels any pending reconnect.
+	 */
+	void DisconnectLiveUpdates();
+	/**
+	 * Callback executed once the live updates session is established, subscribes to the projects.
+	 */
+	void OnLiveUpdatesConnected();
+	/**
+	 * Callback executed when Tolgee pushes a translation change event.
+	 */
+	void OnLiveUpdateReceived(const FString& Destination, const FString& Body);
+	/**
+	 * Reads the text changes of a live update event (Culture -> KeyName -> Text). Removed texts are stored as empty changes.
+	 * Fails if the event doesn't list every change, e.g. when the data was collapsed or keys were renamed.
+	 */
+	static bool ReadLiveUpdate(const FString& Body, TMap<FString, TMap<FString, FString>>& OutChanges);
+	/**
+	 * Patches the changes of a live update event (Culture -> KeyName -> Text) into the project's data and injects them right away.
+	 * The changed cultures are saved to the disk cache once the events settle.
+	 */
+	void PatchLiveUpdate(const FString& ProjectId, const TMap<FString, TMap<FString, FString>>& Changes);
+	/**
+	 * Callback executed when the live updates connection drops, resumes polling and schedules a reconnect.
+	 */
+	void OnLiveUpdatesClosed(const FString& Reason);
+	/**
+	 * Checks the projects for updates now, or right after the check in progress completes.
+	 */
+	void RequestUpdateCheck();
+	/**
+	 * Loads the projects we have no data for from the disk cache and injects everything we have right away.
+	 * Returns the projects that still have no data.
+	 */
+	TArray<FString> InjectCachedProjects();
 	/*
-	 * Runs multiple requests to fetch all projects from the Tolgee dashboard.
+	 * Runs multiple requests to fully fetch the given projects from the Tolgee dashboard.
+	 */
+	void FetchProjects(const TArray<FString>& ProjectIds);
+	/**
+	 * Exports only the given languages of a project and merges them into the cached translations.
+	 */
+	void FetchProjectLanguages(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates);
+	/**
+	 * Fetches the keys of the given languages revised after the given time and patches them into the cached translations.
+	 */
+	void FetchProjectDelta(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const FDateTime& RevisedAfter);
+	/**
+	 * Requests a single page of revised keys and either continues with the next page or applies the accumulated changes (Culture -> KeyName -> Text).
+	 */
+	void FetchProjectDeltaPage(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const FDateTime& RevisedAfter, const FString& Cursor, TSharedRef<TMap<FString, TMap<FString, FString>>, ESPMode::ThreadSafe> Changes);
+	/**
+	 * Reads a page of the translations listing into the changes. Empty texts mark translations that were removed.
 	 */
-	void FetchAllProjects();
+	static bool ReadDeltaPage(const FHttpResponsePtr& Response, TMap<FString, TMap<FString, FString>>& OutChanges, int32& OutNumKeys, FString& OutNextCursor);
 	/**
-	 * Fetches the localization data from the Tolgee dashboard.
+	 * Patches the changes read from the translations listing on top of the project's data and stages the result.
 	 */
-	void FetchFromDashboard(const FString& ProjectId, const FString& RequestUrl);
+	void OnProjectDeltaRead(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, const TMap<FString, TMap<FString, FString>>& Changes, bool bWasSuccessful, int32 Generation);
+	/**
+	 * Applies the changes of a culture (KeyName -> Text) on top of its translations, if any. Empty texts remove the translation.
+	 */
+	static FTolgeeCultureIndexRef PatchCulture(const FTolgeeCultureIndexRef* Existing, const TMap<FString, FString>& Changes);
+	/**
+	 * Converts a Tolgee key name ("Namespace,Key") to the identity of the text it translates.
+	 */
+	static FTextId MakeTextId(const FString& KeyName);
+	/**
+	 * Fetches the localization data from the Tolgee dashboard. LanguageUpdates are stored as the known update times once the response is read.
+	 */
+	void FetchFromDashboard(const FString& ProjectId, const FString& RequestUrl, const TMap<FString, FDateTime>& LanguageUpdates);
 	/**
 	 * Callback function for when the Tolgee dashboard data is retrived.
 	 */
-	void OnFetchedFromDashboard(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString ProjectId);
+	void OnFetchedFromDashboard(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString ProjectId, TMap<FString, FDateTime> LanguageUpdates);
 	/**
-	 * Clears the cached translations and resets the request counters.
+	 * Stops injecting the cached translations and discards the requests in flight. The per-project data is kept warm for the next session.
 	 */
 	void ResetData();
 	/**
-	 * Saves a request content to a temporary zip on disk and reads the translations from it.
+	 * Reads the translations of every culture from an exported zip held in memory. Entries are inflated and parsed in parallel.
+	 * OnCultureParsed is executed from the worker threads as soon as each culture is parsed. Safe to call from any thread.
+	 */
+	static bool ReadTranslationsFromZipContent(const FString& ProjectId, TConstArrayView<uint8> ResponseContent, TFunctionRef<void(const FString&, const FTolgeeCultureIndexRef&)> OnCultureParsed);
+	/**
+	 * Stages the translations of a culture read from a project until all the requests complete.
+	 */
+	void OnCultureRead(const FString& ProjectId, const FString& Culture, const FTolgeeCultureIndexRef& Translations, int32 Generation);
+	/**
+	 * Marks the request of a project as completed once its response was fully processed.
+	 */
+	void OnProjectRead(const FString& ProjectId, const TMap<FString, FDateTime>& LanguageUpdates, bool bWasSuccessful, int32 Generation);
+	/**
+	 * Swaps in the staged translations if every request succeeded, otherwise keeps the previous data.
+	 */
+	void OnAllRequestsCompleted();
+	/**
+	 * Writes the current data of the given projects to the disk cache in the background, only the cultures that changed since they were last saved are written again.
 	 */
-	bool ReadTranslationsFromZipContent(const FString& ProjectId, const TArray<uint8>& ResponseContent);
+	void SaveProjectsToCache(const TArray<FString>& ProjectIds);
+	/**
+	 * Callback executed once a save of the project completed, the cultures it wrote no longer need saving.
+	 */
+	void OnProjectSavedToCache(const FString& ProjectId, uint32 SaveId);
+	/**
+	 * Replaces the translations of the given projects and cultures (ProjectId -> Culture -> Translations) and injects the merged result.
+	 */
+	void ApplyProjectTranslations(const TMap<FString, TMap<FString, FTolgeeCultureIndexRef>>& Translations);
+	/**
+	 * Layers the given cultures (ProjectId -> Culture -> Translations) over the projects configured before them and refreshes CachedTranslations with the merged results.
+	 * Every project in ProjectTranslations is layered again if the configured projects changed since the last call.
+	 */
+	void LayerProjectTranslations(const TMap<FString, TMap<FString, FTolgeeCultureIndexRef>>& Translations);
 	/**
 	 * Callback function executed at a regular interval to refresh the localization data.
 	 */
 	void OnRefreshTick();
 	/**
-	 * Runs an asynchronous request to check if any updates are available for the projects.
+	 * Runs asynchronous requests to check if any updates are available for the projects, the result is handled once all of them complete.
 	 */
 	void FetchIUpdatesAreAvailableAsync();
 	/**
-	 * If any of the projects were updated, fetches resets the data and fetches the latest translations.
+	 * Ends the update check in progress once the requests it started completed, and starts the one queued meanwhile.
+	 */
+	void OnUpdateCheckCompleted();
+	/**
+	 * Returns the last translation update of every language found in a project stats response.
+	 */
+	static TMap<FString, FDateTime> GetLanguageUpdateTimes(const FHttpResponsePtr& Response);
+	/**
+	 * Fetches the languages that were updated since we last read them, for every project.
+	 */
+	void OnProjectsUpdateChecked(const TArray<FString>& ProjectIds, const TArray<FHttpResponsePtr>& Responses);
+	/**
+	 * Translations of each culture, per project. Used to replace the data of a single project when only some of its languages are fetched again.
+	 */
+	TMap<FString, TMap<FString, FTolgeeCultureIndexRef>> ProjectTranslations;
+	/**
+	 * Back buffer of ProjectTranslations, filled while requests are in flight and swapped in once all of them succeeded.
+	 */
+	TMap<FString, TMap<FString, FTolgeeCultureIndexRef>> PendingProjectTranslations;
+	/**
+	 * Language update times matching the data in PendingProjectTranslations.
+	 */
+	TMap<FString, TMap<FString, FDateTime>> PendingLanguageUpdates;
+	/**
+	 * Time the full exports in flight were sent, per project. Stored in ProjectFetchTimes together with the data they describe.
+	 */
+	TMap<FString, FDateTime> PendingFetchTimes;
+	/**
+	 * True if any request of the current batch failed.
+	 */
+	bool bHasFailedRequests = false;
+	/**
+	 * Translations of each culture split by project (layer), in the order of LayeredProjectIds.
+	 */
+	TMap<FString, FTolgeeLayeredCultureIndex> LayeredCultures;
+	/**
+	 * Configured projects when LayeredCultures was built, the index of each project is its layer.
 	 */
-	void FetchIfProjectsWereUpdated();
+	TArray<FString> LayeredProjectIds;
 	/**
-	 * List of cached translations for each culture.
+	 * List of cached translations for each culture, merged across all projects. Only accessed on the game thread, readers on other threads go through the published snapshots.
 	 */
-	TMap<FString, TArray<FTolgeeTranslationData>> CachedTranslations;
+	TMap<FString, FTolgeeCultureIndexRef> CachedTranslations;
 	/**
 	 * Counts the number of requests sent.
 	 */
@@ -74,16 +225,61 @@ private:
 	 * Counts the number of requests completed.
 	 */
 	int32 NumRequestsCompleted = 0;
+	/**
+	 * Incremented every time the data is reset, so results read for a previous fetch are discarded.
+	 */
+	int32 FetchGeneration = 0;
 	/*
 	 * Handle for the refresh tick delegate used to constantly refresh the localization data.
 	 */
 	FTimerHandle RefreshTick;
 	/**
-	 * Last time any translations were fetched from the Tolgee dashboard.
+	 * Last time each project was fully fetched from the Tolgee dashboard.
+	 */
+	TMap<FString, FDateTime> ProjectFetchTimes;
+	/**
+	 * Tolgee instance the per-project data was fetched from, the data is dropped if the settings point somewhere else.
+	 */
+	FString ProjectTranslationsUrl;
+	/**
+	 * Last translation update we read for each language, per project.
+	 */
+	TMap<FString, TMap<FString, FDateTime>> LanguageUpdateTimes;
+	/**
+	 * Projects whose languages were all exported since their data was loaded from the disk cache, kept across sessions like the data itself.
+	 * With delta sync, the other projects get every language exported on their next update check, since the listing of revised keys doesn't include the keys deleted on the dashboard.
 	 */
-	FDateTime LastFetchTime = {0};
+	TSet<FString> FullyExportedProjects;
 	/**
-	 * Flag used to prevent multiple requests from being sent at the same time.
+	 * True from the start of an update check until the exports it started completed, so the same languages are never requested twice.
 	 */
 	TAtomic<bool> bRequestInProgress = false;
+	/**
+	 * True if an update check was requested while another one was in progress.
+	 */
+	bool bUpdateCheckQueued = false;
+	/**
+	 * Connection receiving the translation change events pushed by Tolgee.
+	 */
+	TSharedPtr<FTolgeeStompClient> LiveUpdatesClient;
+	/**
+	 * True while the live updates are connected, polling is paused in the meantime.
+	 */
+	bool bLiveUpdatesConnected = false;
+	/**
+	 * Ticker reconnecting the live updates after the connection dropped.
+	 */
+	FTSTicker::FDelegateHandle ReconnectHandle;
+	/**
+	 * Cultures whose data changed since it was last written to the disk cache, per project, with the save writing them (0 until one is started).
+	 */
+	TMap<FString, TMap<FString, uint32>> UnsavedCultures;
+	/**
+	 * Projects patched by live updates since the last save.
+	 */
+	TSet<FString> LiveUpdatedProjects;
+	/**
+	 * Ticker saving the projects patched by live updates once no event arrived for a while.
+	 */
+	FTSTicker::FDelegateHandle LiveUpdateSaveHandle;
 };
\ No newline at end of file
@@ -58,6 +58,32 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|In-Context")
 	float RefreshInterval = 20.0f;
 
+	/**
+	 * If enabled, projects that were already fetched only download the keys revised since the last sync instead of a full export.
+	 * NOTE: Keys deleted on the dashboard are only removed by a full export, which runs for every project on its first update check after the editor started.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|In-Context")
+	bool bUseDeltaSync = false;
+
+	/**
+	 * Number of keys requested per page when using delta sync.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|In-Context", meta = (EditCondition = "bUseDeltaSync", ClampMin = "1", ClampMax = "1000"))
+	int32 DeltaSyncPageSize = 250;
+
+	/**
+	 * If enabled, translation changes pushed by Tolgee over a WebSocket are patched in right away instead of waiting for the next RefreshInterval.
+	 * Events that don't describe the change (e.g. renamed keys) trigger an update check. Polling is only used while the connection is down.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|In-Context")
+	bool bUseLiveUpdates = false;
+
+	/**
+	 * Delay in seconds before reconnecting after the live updates connection dropped.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Tolgee|In-Context", meta = (EditCondition = "bUseLiveUpdates", ClampMin = "1.0"))
+	float LiveUpdatesReconnectDelay = 5.0f;
+
 	/**
 	 * Configurable settings for each localization target.
 	 */
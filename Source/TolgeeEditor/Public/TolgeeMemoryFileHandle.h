@@ -0,0 +1,37 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/ArrayView.h>
+#include <GenericPlatform/GenericPlatformFile.h>
+
+/**
+ * Read-only file handle over a memory buffer, used to open archives (e.g.: FZipArchiveReader) without writing them to disk first.
+ * The buffer is not copied and must outlive the handle. Each handle has its own position, so multiple handles can read the same buffer in parallel.
+ */
+class FTolgeeMemoryFileHandle : public IFileHandle
+{
+public:
+	explicit FTolgeeMemoryFileHandle(TConstArrayView<uint8> InBuffer);
+
+	// Begin IFileHandle interface
+	virtual int64 Tell() override;
+	virtual bool Seek(int64 NewPosition) override;
+	virtual bool SeekFromEnd(int64 NewPositionRelativeToEnd = 0) override;
+	virtual bool Read(uint8* Destination, int64 BytesToRead) override;
+	virtual bool Write(const uint8* Source, int64 BytesToWrite) override;
+	virtual bool Flush(const bool bFullFlush = false) override;
+	virtual bool Truncate(int64 NewSize) override;
+	virtual int64 Size() override;
+	// End IFileHandle interface
+
+private:
+	/**
+	 * Content exposed by the handle.
+	 */
+	TConstArrayView<uint8> Buffer;
+	/**
+	 * Current read position inside the buffer.
+	 */
+	int64 Position = 0;
+};
@@ -0,0 +1,95 @@
+// Copyright (c) Tolgee 2022-2025. All Rights Reserved.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/Map.h>
+#include <Containers/UnrealString.h>
+#include <Delegates/Delegate.h>
+#include <Templates/SharedPointer.h>
+
+class IWebSocket;
+
+using FOnStompConnected = TDelegate<void()>;
+using FOnStompMessage = TDelegate<void(const FString& Destination, const FString& Body)>;
+using FOnStompClosed = TDelegate<void(const FString& Reason)>;
+
+/**
+ * Minimal STOMP 1.2 client running over a WebSocket, used to receive the live update events published by Tolgee.
+ * Only the frames required to subscribe and receive messages are supported (CONNECT, SUBSCRIBE, CONNECTED, MESSAGE and ERROR).
+ * All the callbacks are executed on the game thread.
+ */
+class FTolgeeStompClient : public TSharedFromThis<FTolgeeStompClient>
+{
+public:
+	/**
+	 * Opens the WebSocket and sends the STOMP CONNECT frame with the given headers once it's established.
+	 */
+	void Connect(const FString& Url, const TMap<FString, FString>& ConnectHeaders);
+	/**
+	 * Subscribes to the given destination. Only valid once OnConnected was executed.
+	 */
+	void Subscribe(const FString& Destination);
+	/**
+	 * Closes the connection without executing OnClosed.
+	 */
+	void Close();
+	/**
+	 * Executed once the STOMP session is established.
+	 */
+	FOnStompConnected OnConnected;
+	/**
+	 * Executed for every message received on one of the subscriptions.
+	 */
+	FOnStompMessage OnMessage;
+	/**
+	 * Executed when the connection fails, drops or the server reports an error.
+	 */
+	FOnStompClosed OnClosed;
+
+private:
+	/**
+	 * Callback executed when the WebSocket is established.
+	 */
+	void OnSocketConnected();
+	/**
+	 * Callback executed when data is received, frames might be split across multiple messages.
+	 */
+	void OnSocketMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+	/**
+	 * Callback executed when the WebSocket couldn't be established.
+	 */
+	void OnSocketConnectionError(const FString& Error);
+	/**
+	 * Callback executed when the WebSocket is closed.
+	 */
+	void OnSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
+	/**
+	 * Parses and dispatches a single frame (without the null terminator).
+	 */
+	void HandleFrame(const FString& Frame);
+	/**
+	 * Serializes and sends a frame.
+	 */
+	void SendFrame(const FString& Command, const TMap<FString, FString>& Headers);
+	/**
+	 * Closes the connection and executes OnClosed.
+	 */
+	void NotifyClosed(const FString& Reason);
+	/**
+	 * Underlying WebSocket connection.
+	 */
+	TSharedPtr<IWebSocket> WebSocket;
+	/**
+	 * Headers sent with the CONNECT frame.
+	 */
+	TMap<FString, FString> PendingConnectHeaders;
+	/**
+	 * Data received after the last complete frame.
+	 */
+	TArray<uint8> ReceiveBuffer;
+	/**
+	 * Id used for the next subscription.
+	 */
+	int32 NextSubscriptionId = 0;
+};
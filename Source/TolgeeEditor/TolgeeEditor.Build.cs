@@ -12,20 +12,25 @@ public class TolgeeEditor : ModuleRules
 				"Core",
 				"CoreUObject",
 				"DeveloperSettings",
+				"DeveloperToolSettings",
 				"EditorSubsystem",
 				"Engine",
 				"FileUtilities",
 				"HTTP",
+				"HTTPServer",
 				"Json",
 				"JsonUtilities",
 				"Localization", 
 				"LocalizationCommandletExecution", 
 				"MainFrame",
+				"Networking",
 				"Projects",
 				"Slate",
 				"SlateCore", 
+				"Sockets",
 				"UnrealEd", 
 				"WebBrowser",
+				"WebSockets",
 
 				"Tolgee"
 			}